@@ -0,0 +1,114 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           LPC17xx.h (host)
+** Descriptions:        Sostituto di LPC17xx.h per compilare GLCD, AsciiLib e TouchPanel su PC.
+** I registri usati dai driver sono oggetti IoReg: ogni lettura e scrittura passa
+** dall'emulatore (glcd_emu.cpp), che decodifica il bus 8080 dell'LCD e l'SSP1 del touch.
+** Per questo i sorgenti del firmware vanno compilati come C++ (g++ -x c++).
+** Correlated files:    glcd_emu.h, glcd_emu.cpp
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __LPC17xx_H__
+#define __LPC17xx_H__
+
+#ifndef __cplusplus
+#error "Host/LPC17xx.h: compilare i sorgenti del firmware con g++ -x c++"
+#endif
+
+#include <stdint.h>
+
+#define __INLINE    inline
+
+/* Un registro a 32 bit osservato dall'emulatore */
+struct IoReg {
+    uint32_t value;
+
+    operator uint32_t() const;
+    IoReg &operator=( uint32_t v );
+    IoReg &operator=( const IoReg &r )  { return *this = (uint32_t)r; }
+    IoReg &operator|=( uint32_t v )     { return *this = (uint32_t)*this | v; }
+    IoReg &operator&=( uint32_t v )     { return *this = (uint32_t)*this & v; }
+    IoReg &operator^=( uint32_t v )     { return *this = (uint32_t)*this ^ v; }
+};
+
+/* Solo i campi usati dai driver compilati su PC */
+typedef struct {
+    IoReg FIODIR, FIOMASK, FIOPIN, FIOSET, FIOCLR;
+    IoReg FIOPIN0;                      /* byte basso di FIOPIN (sul micro e' un alias) */
+} LPC_GPIO_TypeDef;
+
+typedef struct {
+    IoReg CR0, CR1, DR, SR, CPSR;
+} LPC_SSP_TypeDef;
+
+typedef struct {
+    IoReg PCONP, PCLKSEL0, PCLKSEL1, EXTINT;
+} LPC_SC_TypeDef;
+
+typedef struct {
+    IoReg PINSEL0, PINSEL1, PINSEL2, PINSEL3, PINSEL4;
+} LPC_PINCON_TypeDef;
+
+typedef struct {
+    IoReg IO0IntEnF, IO0IntClr, IO2IntEnF, IO2IntEnR, IO2IntClr, IO2IntStatF;
+} LPC_GPIOINT_TypeDef;
+
+/* Core: CYCCNT avanza a ogni lettura, SysTick scade subito (delay.h) */
+typedef struct {
+    IoReg CTRL, CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    IoReg DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    IoReg CTRL, LOAD, VAL;
+} SysTick_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+#define SysTick_CTRL_ENABLE_Msk         (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk        (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk      (1UL << 2)
+#define SysTick_CTRL_COUNTFLAG_Msk      (1UL << 16)
+#define SysTick_LOAD_RELOAD_Msk         (0xFFFFFFUL)
+
+extern LPC_GPIO_TypeDef    emu_gpio[5];
+extern LPC_SSP_TypeDef     emu_ssp1;
+extern LPC_SC_TypeDef      emu_sc;
+extern LPC_PINCON_TypeDef  emu_pincon;
+extern LPC_GPIOINT_TypeDef emu_gpioint;
+extern DWT_Type            emu_dwt;
+extern CoreDebug_Type      emu_coredebug;
+extern SysTick_Type        emu_systick;
+
+#define LPC_GPIO0       (&emu_gpio[0])
+#define LPC_GPIO1       (&emu_gpio[1])
+#define LPC_GPIO2       (&emu_gpio[2])
+#define LPC_SSP1        (&emu_ssp1)
+#define LPC_SC          (&emu_sc)
+#define LPC_PINCON      (&emu_pincon)
+#define LPC_GPIOINT     (&emu_gpioint)
+#define DWT             (&emu_dwt)
+#define CoreDebug       (&emu_coredebug)
+#define SysTick         (&emu_systick)
+
+extern uint32_t SystemCoreClock;
+
+/* NVIC: sul PC non ci sono interrupt, le chiamate non fanno nulla */
+typedef enum {
+    SysTick_IRQn = -1, EINT0_IRQn = 18, EINT1_IRQn, EINT2_IRQn, EINT3_IRQn
+} IRQn_Type;
+
+static inline void NVIC_EnableIRQ( IRQn_Type irq )                  { (void)irq; }
+static inline void NVIC_DisableIRQ( IRQn_Type irq )                 { (void)irq; }
+static inline void NVIC_SetPriority( IRQn_Type irq, uint32_t prio ) { (void)irq; (void)prio; }
+static inline void __disable_irq( void )    { }
+static inline void __enable_irq( void )     { }
+static inline uint32_t __get_PRIMASK( void ) { return 0; }
+static inline uint32_t __get_IPSR( void )   { return 0; }
+static inline void __WFI( void )            { }
+static inline uint32_t __CLZ( uint32_t v ) { return v ? __builtin_clz(v) : 32; }
+
+#endif /* end __LPC17xx_H__ */
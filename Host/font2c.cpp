@@ -0,0 +1,239 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           font2c.cpp
+** Descriptions:        Generatore dei font proporzionali di font.h: rasterizza un font TrueType con
+** FreeType alla dimensione in pixel richiesta (rendering monocromatico con hinting, il migliore
+** per 1 bit), e scrive bitmap, avanzamenti e coppie di kerning come array const.
+** Con -b 2 o -b 4 i pixel sono livelli di copertura (antialiasing, hinting leggero).
+** I caratteri si danno come intervallo di codici ("32-126") o come elenco (" 0123456789:").
+** Con -t l'altezza della riga e' quella dell'inchiostro dei caratteri scelti invece di
+** ascendente + discendente del font: per le cifre grandi si risparmiano le righe vuote.
+**
+** Compilazione (dalla cartella del progetto):
+**   g++ -O2 -IHost -I/usr/include/freetype2 Host/font2c.cpp -lfreetype -o font2c
+** Uso:
+**   ./font2c [-t] [-b bpp] DejaVuSans.ttf 16 font_sans16 32-126 > Source/font/font_sans16.c
+** Correlated files:    font.h, lib_font.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "LPC17xx.h"
+#include "../Source/font/font.h"
+
+typedef struct {
+    int     present;
+    int     w, h, x, top, adv;          /* top: riga dell'inchiostro sopra la linea di base */
+    std::vector<uint8_t> bits;          /* h righe di (w * bpp + 7) / 8 byte */
+} Glyph;
+
+/******************************************************************************
+** Function name:       parse_chars
+** Descriptions:        "a-b" (codici decimali) o elenco di caratteri ASCII.
+******************************************************************************/
+static int parse_chars( const char *s, int used[256] )
+{
+    int a, b, n = 0;
+    char end;
+
+    if( sscanf(s, "%d-%d%c", &a, &b, &end) == 2 ){
+        for( ; a <= b && a < 256; a++ ){
+            if( a >= 32 ){
+                used[a] = 1;
+                n++;
+            }
+        }
+        return n;
+    }
+    for( ; *s; s++ ){
+        if( (uint8_t)*s >= 32 && (uint8_t)*s < 128 ){
+            used[(uint8_t)*s] = 1;
+            n++;
+        }
+    }
+    return n;
+}
+
+/******************************************************************************
+** Function name:       load_glyph
+** Descriptions:        Rasterizza il carattere c: in bianco e nero con bpp = 1,
+**                      altrimenti in grigi ridotti a 2^bpp livelli.
+******************************************************************************/
+static int load_glyph( FT_Face face, int c, int bpp, Glyph &g )
+{
+    FT_Bitmap *bm;
+    int x, y, v, bytes, max = (1 << bpp) - 1;
+
+    if( FT_Get_Char_Index(face, c) == 0 ||
+        FT_Load_Char(face, c, FT_LOAD_RENDER | (bpp == 1 ? FT_LOAD_TARGET_MONO : FT_LOAD_TARGET_LIGHT)) != 0 ){
+        return -1;
+    }
+    bm    = &face->glyph->bitmap;
+    g.w   = bm->width;
+    g.h   = bm->rows;
+    g.x   = face->glyph->bitmap_left;
+    g.top = face->glyph->bitmap_top;
+    g.adv = (int)((face->glyph->advance.x + 32) >> 6);
+    bytes = (g.w * bpp + 7) / 8;
+    for( y = 0; y < g.h; y++ ){
+        if( bpp == 1 ){
+            g.bits.insert(g.bits.end(), bm->buffer + y * bm->pitch, bm->buffer + y * bm->pitch + bytes);
+            continue;
+        }
+        g.bits.resize(g.bits.size() + bytes);
+        for( x = 0; x < g.w; x++ ){
+            v = (bm->buffer[y * bm->pitch + x] * max + 127) / 255;
+            g.bits[g.bits.size() - bytes + x * bpp / 8] |= v << (8 - bpp - x * bpp % 8);
+        }
+    }
+    for( y = 0; y < (int)g.bits.size() && g.bits[y] == 0; y++ ){
+    }
+    if( y == (int)g.bits.size() ){      /* spazio: FreeType da' una bitmap vuota, anche 1x1 */
+        g.w = g.h = 0;
+        g.bits.clear();
+    }
+    g.present = 1;
+    return 0;
+}
+
+int main( int argc, char **argv )
+{
+    FT_Library lib;
+    FT_Face    face;
+    Glyph      g[256];
+    int        used[256] = { 0 };
+    int        a = 1, tight = 0, bpp = 1, ink = 0, px, c, d, first = 256, last = 0, asc, desc, top = 0, bottom = 0;
+    std::vector<uint8_t> data;
+    std::vector<uint16_t> offset(256);
+    std::vector<int> kern;               /* (sinistro << 16 | destro << 8 | dx) */
+    FT_Vector k;
+    const char *name;
+
+    for( ; a < argc && argv[a][0] == '-'; a++ ){
+        if( strcmp(argv[a], "-t") == 0 ){
+            tight = 1;
+        }else if( strcmp(argv[a], "-b") == 0 && a + 1 < argc ){
+            bpp = atoi(argv[++a]);
+        }else{
+            break;
+        }
+    }
+    if( argc - a != 4 || (bpp != 1 && bpp != 2 && bpp != 4) ){
+        fprintf(stderr, "uso: %s [-t] [-b 1|2|4] font.ttf pixel nome caratteri\n", argv[0]);
+        return 2;
+    }
+    px   = atoi(argv[a + 1]);
+    name = argv[a + 2];
+    if( px <= 0 || px > 200 || parse_chars(argv[a + 3], used) == 0 ){
+        fprintf(stderr, "dimensione o caratteri non validi\n");
+        return 2;
+    }
+    if( FT_Init_FreeType(&lib) != 0 || FT_New_Face(lib, argv[a], 0, &face) != 0 ){
+        fprintf(stderr, "%s: impossibile aprire il font\n", argv[a]);
+        return 1;
+    }
+    FT_Set_Pixel_Sizes(face, 0, px);
+
+    asc    = (int)((face->size->metrics.ascender + 63) >> 6);
+    desc   = (int)(-face->size->metrics.descender >> 6);
+    for( c = 0; c < 256; c++ ){
+        g[c].present = 0;
+        if( !used[c] ){
+            continue;
+        }
+        if( load_glyph(face, c, bpp, g[c]) != 0 ){
+            fprintf(stderr, "'%c' non e' nel font, ignorato\n", c);
+            continue;
+        }
+        first = (c < first) ? c : first;
+        last  = c;
+        if( g[c].h > 0 ){
+            top    = (!ink || g[c].top > top) ? g[c].top : top;
+            bottom = (!ink || g[c].top - g[c].h < bottom) ? g[c].top - g[c].h : bottom;
+            ink    = 1;
+        }
+    }
+    if( first > last ){
+        fprintf(stderr, "nessun carattere nel font\n");
+        return 1;
+    }
+    if( tight && ink ){
+        asc  = top;
+        desc = -bottom;
+    }
+    if( asc + desc > 255 ){
+        fprintf(stderr, "riga troppo alta\n");
+        return 1;
+    }
+
+    for( c = first; c <= last; c++ ){
+        offset[c] = (uint16_t)data.size();
+        if( g[c].present ){
+            if( asc - g[c].top < -128 || g[c].x < -128 || g[c].x > 127 || g[c].w > 255 || g[c].adv > 255 ){
+                fprintf(stderr, "'%c' fuori dai limiti del formato\n", c);
+                return 1;
+            }
+            data.insert(data.end(), g[c].bits.begin(), g[c].bits.end());
+        }
+        if( data.size() > 0xFFFF ){
+            fprintf(stderr, "i dati superano 64 KB\n");
+            return 1;
+        }
+        if( !g[c].present || !FT_HAS_KERNING(face) ){
+            continue;
+        }
+        for( d = first; d <= last; d++ ){
+            if( g[d].present &&
+                FT_Get_Kerning(face, FT_Get_Char_Index(face, c), FT_Get_Char_Index(face, d),
+                               FT_KERNING_DEFAULT, &k) == 0 && (k.x >> 6) != 0 ){
+                kern.push_back(c << 16 | d << 8 | (uint8_t)(int8_t)(k.x >> 6));
+            }
+        }
+    }
+
+    printf("/* Generato da Host/font2c.cpp: %s %s, %d pixel\n", face->family_name, face->style_name, px);
+    printf(" *   font2c %s%s%s%s %d %s \"%s\"\n", tight ? "-t " : "", bpp > 1 ? "-b " : "",
+           bpp == 2 ? "2 " : bpp == 4 ? "4 " : "", strrchr(argv[a], '/') ? strrchr(argv[a], '/') + 1 : argv[a], px, name, argv[a + 3]);
+    printf(" * riga di %d pixel, %d bit per pixel, %u byte di bitmap, %u coppie di kerning */\n",
+           asc + desc, bpp, (unsigned)data.size(), (unsigned)kern.size());
+    printf("#include \"font.h\"\n\n");
+
+    printf("static const FONT_Glyph %s_glyph[%d] = {\n", name, last - first + 1);
+    for( c = first; c <= last; c++ ){
+        if( g[c].present ){
+            printf("    { %5u, %3d, %3d, %4d, %4d, %3d },   /* '%s%c' */\n", offset[c], g[c].w, g[c].h,
+                   g[c].x, asc - g[c].top, g[c].adv, (c == '\\' || c == '\'') ? "\\" : "", c);
+        }else{
+            printf("    { %5u,   0,   0,    0,    0,   0 },   /* assente */\n", offset[c]);
+        }
+    }
+    printf("};\n\n");
+
+    printf("static const uint8_t %s_data[%u] = {", name, (unsigned)(data.size() ? data.size() : 1));
+    for( size_t i = 0; i < data.size(); i++ ){
+        printf("%s0x%02x,", (i % 16) ? " " : "\n    ", data[i]);
+    }
+    printf("%s\n};\n\n", data.empty() ? "\n    0" : "");
+
+    if( !kern.empty() ){
+        printf("static const FONT_Kern %s_kern[%u] = {", name, (unsigned)kern.size());
+        for( size_t i = 0; i < kern.size(); i++ ){
+            printf("%s{ %3d, %3d, %2d },", (i % 6) ? " " : "\n    ",
+                   kern[i] >> 16, (kern[i] >> 8) & 0xFF, (int8_t)(kern[i] & 0xFF));
+        }
+        printf("\n};\n\n");
+    }
+
+    printf("extern const FONT_Font %s;\n\n", name);
+    printf("const FONT_Font %s = { %d, %d, %d, %d, %u, %s_glyph, %s_data, %s%s };\n",
+           name, asc + desc, first, last, bpp, (unsigned)kern.size(), name, name,
+           kern.empty() ? "NULL" : name, kern.empty() ? "" : "_kern");
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(lib);
+    return 0;
+}
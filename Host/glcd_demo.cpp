@@ -0,0 +1,334 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           glcd_demo.cpp
+** Descriptions:        Esegue le primitive GLCD e la lettura del touch sull'emulatore: per ogni passo
+** stampa i contatori del bus e l'hash della GRAM, e se si passa una cartella salva un PPM.
+** Ogni passo si confronta con la tabella demo_expect (hash e contatori): una modifica al
+** driver che cambia i pixel o il costo sul bus fa uscire con 1, come una lettura sbagliata
+** di getpoint o del touch. Se la modifica e' voluta, sotto il passo diverso c'e' la riga
+** nuova da copiare nella tabella.
+**
+** Compilazione (dalla cartella del progetto, i sorgenti del firmware come C++):
+**   g++ -O2 -IHost -x c++ Source/GLCD/GLCD.c Source/GLCD/AsciiLib.c Source/TouchPanel/TouchPanel.c
+**       Source/delay/lib_delay.c Source/console/lib_console.c Source/fb/lib_fb.c Source/scene/lib_scene.c
+**       Source/sprite/lib_sprite.c Source/image/lib_image.c Source/image/img_test.c
+**       Source/hzfont/lib_hzfont.c Source/hzfont/hz_font.c Source/text/lib_text.c
+**       Source/font/lib_font.c Source/font/font_sans12.c Source/font/font_sans16.c Source/font/font_num48.c
+**       Source/font/font_sans16_aa.c Source/font/font_num48_aa.c Source/gcache/lib_gcache.c
+**       -x none Host/glcd_emu.cpp Host/glcd_demo.cpp -o glcd_demo
+** Uso:
+**   ./glcd_demo [cartella_ppm]
+** Correlated files:    glcd_emu.h, glcd_emu.cpp
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "LPC17xx.h"
+#include "glcd_emu.h"
+#include "../Source/GLCD/GLCD.h"
+#include "../Source/TouchPanel/TouchPanel.h"
+#include "../Source/console/console.h"
+#include "../Source/fb/fb.h"
+#include "../Source/scene/scene.h"
+#include "../Source/sprite/sprite.h"
+#include "../Source/image/image.h"
+#include "../Source/hzfont/hzfont.h"
+#include "../Source/text/text.h"
+#include "../Source/font/font.h"
+#include "../Source/gcache/gcache.h"
+
+static const uint16_t fb_pal[FB_COLORS] = { Black, White, Red, Yellow };
+
+static const char *ppm_dir;
+static uint8_t     step;
+
+static SCENE_Obj_t sc_title, sc_panel, sc_ball;
+
+static uint16_t    spr_img[16 * 16], spr_save[2 * 16 * 16];
+static SPRITE_t    spr;
+
+/* Uscita attesa di ogni passo, nell'ordine di main */
+typedef struct {
+    const char *name;
+    uint32_t    gpio_writes, bus_index, bus_data, bus_reads, reg_writes, gram_pixels, ssp_bytes;
+    uint32_t    hash;
+} DEMO_Expect;
+
+static const DEMO_Expect demo_expect[] = {
+    { "init",          1426,    57,     56,    1,    56,      0,   0, 0xc18e7dc5 },
+    { "clear",       155123,    13,  76812,    0,    12,  76800,   0, 0x7b7dadc5 },
+    { "fillrect",     20479,    13,  10012,    0,    12,  10000,   0, 0xf9c5f905 },
+    { "setpoint",        75,     3,      3,    0,     2,      1,   0, 0x01984774 },
+    { "getpoint",        85,     3,      2,    2,     2,      0,   0, 0x01984774 },
+    { "line_h",         557,     3,    242,    0,     2,    240,   0, 0xdffd2174 },
+    { "line_v",         968,    13,    332,    0,    12,    320,   0, 0xd000af7a },
+    { "line_diag",    24005,   960,    960,    0,   640,    320,   0, 0xfc8dd21e },
+    { "rect",          1346,    32,    304,    0,    28,    276,   0, 0x0ffa4936 },
+    { "fillcircle",   23541,   303,   8223,    0,   202,   8021,   0, 0x4a901efc },
+    { "roundrect",     9806,    79,   3964,    0,    56,   3908,   0, 0xfda1eca4 },
+    { "filltri",      17478,   300,   5250,    0,   200,   5050,   0, 0x02c8dacc },
+    { "putchar",        701,    13,    140,    0,    12,    128,   0, 0xe1d340f4 },
+    { "gui_text",      6553,    13,   2444,    0,    12,   2432,   0, 0x949d3db6 },
+    { "touch",           39,     0,      0,    0,     0,      0,  54, 0x949d3db6 },
+    { "con_fill",    262082,   290, 116748,    0,   268, 116480,   0, 0xc72413a0 },
+    { "con_scroll",   13072,    28,   5658,    0,    26,   5632,   0, 0x4a4b8230 },
+    { "fb_full",     155485,    15,  76814,    0,    14,  76800,   0, 0x24fea9a1 },
+    { "fb_move",       2515,    13,   1036,    0,    12,   1024,   0, 0x69dea9a1 },
+    { "scene_full",  156699,    13,  76812,    0,    12,  76800,   0, 0xec8870b1 },
+    { "scene_move",     931,    13,    268,    0,    12,    256,   0, 0x7cc33d5d },
+    { "spr_show",      2307,    26,    280,  257,    24,    256,   0, 0x77d152d0 },
+    { "spr_move",      1668,    26,    344,   65,    24,    320,   0, 0xb03b4a00 },
+    { "image",        11719,    13,   4108,    0,    12,   4096,   0, 0xe7cc4b82 },
+    { "image_clip",    7315,    13,   2572,    0,    12,   2560,   0, 0x5e8564eb },
+    { "clip",         50000,   429,  19148,    0,   296,  18852,   0, 0x4b39ea81 },
+    { "hz_text",       7471,    91,   1748,    0,    84,   1664,   0, 0xde6b491d },
+    { "text",        174501,    78,  83208,    0,    72,  83136,   0, 0x8ece3b04 },
+    { "font",        251879,  2145,  97453,    0,  1980,  95473,   0, 0x3688cbf0 },
+    { "font_aa",     188102,    52,  87812,    0,    48,  87764,   0, 0x90098d54 },
+    { "gcache",      752747,  1573, 285612,    0,  1452, 284160,   0, 0x391f8629 },
+};
+
+#define DEMO_STEPS  (sizeof(demo_expect) / sizeof(demo_expect[0]))
+
+static unsigned    demo_errors;
+
+/* Un controllo che non e' un passo (letture, statistiche) */
+static void check( int ok, const char *what )
+{
+    if( !ok ){
+        printf("ERRORE: %s\n", what);
+        demo_errors++;
+    }
+}
+
+/* Una riga della tabella: contatori dall'ultimo emu_counts_clear e hash della GRAM,
+ * confrontati con demo_expect[step] */
+static void report( const char *name )
+{
+    const EMU_Counts  *c = emu_counts();
+    const DEMO_Expect *e = (step < DEMO_STEPS) ? &demo_expect[step] : NULL;
+    uint32_t hash = emu_gram_hash();
+    char path[256];
+
+    printf("%-10s %8u %7u %7u %5u %6u %7u %4u  %08x\n", name,
+           c->gpio_writes, c->bus_index, c->bus_data, c->bus_reads,
+           c->reg_writes, c->gram_pixels, c->ssp_bytes, hash);
+
+    if( e == NULL || strcmp(e->name, name) != 0 || e->hash != hash ||
+        e->gpio_writes != c->gpio_writes || e->bus_index != c->bus_index ||
+        e->bus_data != c->bus_data || e->bus_reads != c->bus_reads ||
+        e->reg_writes != c->reg_writes || e->gram_pixels != c->gram_pixels ||
+        e->ssp_bytes != c->ssp_bytes ){
+        if( e != NULL ){
+            printf("%-10s %8u %7u %7u %5u %6u %7u %4u  %08x  <- ERRORE: atteso\n", e->name,
+                   e->gpio_writes, e->bus_index, e->bus_data, e->bus_reads,
+                   e->reg_writes, e->gram_pixels, e->ssp_bytes, e->hash);
+        }else{
+            printf("ERRORE: passo in piu'\n");
+        }
+        printf("  riga nuova: { \"%s\", %u, %u, %u, %u, %u, %u, %u, 0x%08x },\n", name,
+               c->gpio_writes, c->bus_index, c->bus_data, c->bus_reads,
+               c->reg_writes, c->gram_pixels, c->ssp_bytes, hash);
+        demo_errors++;
+    }
+
+    if( ppm_dir ){
+        snprintf(path, sizeof(path), "%s/%02u_%s.ppm", ppm_dir, step, name);
+        if( emu_dump_ppm(path) != 0 ){
+            fprintf(stderr, "impossibile scrivere %s\n", path);
+        }
+    }
+    step++;
+    emu_counts_clear();
+}
+
+int main( int argc, char **argv )
+{
+    Coordinate *p;
+    uint16_t color;
+    uint16_t i;
+
+    ppm_dir = (argc > 1) ? argv[1] : NULL;
+
+    emu_reset();
+    printf("%-10s %8s %7s %7s %5s %6s %7s %4s  %s\n", "step",
+           "gpio_wr", "index", "data", "reads", "regs", "pixels", "ssp", "gram_hash");
+
+    LCD_Initialization();
+    report("init");
+
+    LCD_Clear(Blue);
+    report("clear");
+
+    LCD_FillRect(20, 20, 100, 100, Red);
+    report("fillrect");
+
+    LCD_SetPoint(MAX_X / 2, MAX_Y / 2, White);
+    report("setpoint");
+
+    color = LCD_GetPoint(MAX_X / 2, MAX_Y / 2);
+    report("getpoint");
+    check(color == White, "getpoint: letto un colore diverso da White");
+
+    LCD_DrawLine(0, 10, MAX_X - 1, 10, Yellow);
+    report("line_h");
+
+    LCD_DrawLine(10, 0, 10, MAX_Y - 1, Yellow);
+    report("line_v");
+
+    LCD_DrawLine(0, 0, MAX_X - 1, MAX_Y - 1, Green);
+    report("line_diag");
+
+    LCD_DrawRect(150, 20, 80, 60, White);
+    report("rect");
+
+    LCD_FillCircle(180, 240, 50, Magenta);
+    report("fillcircle");
+
+    LCD_FillRoundRect(130, 90, 100, 40, 10, Cyan);
+    report("roundrect");
+
+    LCD_FillTriangle(20, 200, 119, 200, 20, 299, Orange);
+    report("filltri");
+
+    PutChar(40, 140, 'A', White, Black);
+    report("putchar");
+
+    GUI_Text(0, 160, (uint8_t *)"Template ASE - host", White, Black);
+    report("gui_text");
+
+    TP_Init();
+    emu_touch(1, 2000, 1500);
+    p = Read_Ads7846();
+    emu_touch(0, 0, 0);
+    report("touch");
+    check(p != NULL && p->x == 2000 && p->y == 1500, "touch: lettura errata");
+
+    /* console: riempie lo schermo, poi una riga di log con scorrimento */
+    console_init(Green, Black);
+    for( i = 0; i < CONSOLE_ROWS; i++ ){
+        console_printf("log %02u: RIT ok\n", i);
+    }
+    report("con_fill");
+
+    console_printf("log %02u: RIT ok\n", i);
+    report("con_scroll");
+
+    console_exit();
+
+    /* framebuffer ombra: copia completa, poi un quadrato 16x16 che si sposta */
+    fb_init(fb_pal);
+    fb_fill_rect(100, 100, 16, 16, 2);
+    fb_text(8, 8, "fb", 1, 0);
+    fb_flush();
+    report("fb_full");
+
+    fb_fill_rect(100, 100, 16, 16, 0);
+    fb_fill_rect(104, 100, 16, 16, 2);
+    fb_flush();
+    report("fb_move");
+
+    /* scena: prima composizione completa, poi un oggetto che si sposta sopra un altro */
+    scene_init(White);
+    scene_rect(&sc_panel, 20, 60, 200, 120, Blue2, 0);
+    scene_text(&sc_title, 40, 100, "MENU", White, Blue2, SCENE_TRANSPARENT, 1);
+    scene_rect(&sc_ball, 30, 90, 12, 12, Red, 2);
+    scene_add(&sc_panel);
+    scene_add(&sc_title);
+    scene_add(&sc_ball);
+    scene_render();
+    report("scene_full");
+
+    scene_move(&sc_ball, 34, 94);
+    scene_render();
+    report("scene_move");
+
+    /* sprite 16x16 a cerchio (angoli trasparenti) sopra la scena */
+    for( i = 0; i < 16 * 16; i++ ){
+        spr_img[i] = ((i % 16 - 8) * (i % 16 - 8) + (i / 16 - 8) * (i / 16 - 8) < 56) ? Yellow : Magenta;
+    }
+    sprite_init(&spr, spr_img, 16, 16, Magenta, spr_save);
+    sprite_show(&spr, 60, 120);
+    report("spr_show");
+
+    sprite_move(&spr, 64, 120);
+    report("spr_move");
+
+    /* immagine compressa: intera, poi tagliata dal bordo destro */
+    image_draw(88, 200, img_test);
+    report("image");
+
+    image_draw(MAX_X - 40, 200, img_test);
+    report("image_clip");
+
+    /* pannello: linea, cerchio, testo e immagine tagliati al rettangolo di clip */
+    LCD_PushClip(40, 40, 160, 100);
+    LCD_Clear(Grey);
+    LCD_DrawLine(0, 0, MAX_X - 1, 200, Red);
+    LCD_FillCircle(40, 140, 30, Blue);
+    GUI_Text(150, 60, (uint8_t *)"pannello", Black, Grey);
+    image_draw(170, 100, img_test);
+    LCD_PopClip();
+    report("clip");
+
+    /* caratteri cinesi del sottoinsieme compresso, per codice Unicode e GB2312 */
+    {
+        static const uint16_t txt[] = { 0x4E2D, 0x6587, 0x6C49, 0x5B57, 0x6D4B, 0x8BD5 };
+        static const uint8_t  gb[] = { 0xB2, 0xE2 };
+        uint16_t k;
+
+        for( k = 0; k < sizeof(txt) / sizeof(txt[0]); k++ ){
+            hz_draw(20 + 18 * k, 260, &hz_font, hz_find(&hz_font, txt[k]), White, Blue);
+        }
+        hz_draw(MAX_X - 8, 290, &hz_font, hz_find_gb(&hz_font, gb), Yellow, Black);
+        report("hz_text");
+    }
+
+    /* testo UTF-8 misto, a capo in una colonna di 120 pixel e tagliato da un pannello */
+    LCD_Clear(Black);
+    text_box(10, 10, 120, "Punti: \xe5\x88\x86\xe6\x95\xb0 1234\n"
+             "Premi KEY1 per \xe5\xbc\x80\xe5\xa7\x8b\xe6\xb8\xb8\xe6\x88\x8f", TEXT_UTF8, White, Blue);
+    LCD_PushClip(20, 100, 100, 40);
+    text_draw(4, 110, "\xe6\xb8\xb8\xe6\x88\x8f\xe7\xbb\x93\xe6\x9d\x9f GAME OVER", TEXT_UTF8, Yellow, Red);
+    LCD_PopClip();
+    report("text");
+
+    /* font proporzionali: cifre grandi con sfondo, testo con kerning, testo senza sfondo */
+    LCD_Clear(Black);
+    font_draw((MAX_X - font_width(&font_num48, "12:34")) / 2, 20, &font_num48, "12:34", White, Blue);
+    font_draw(10, 80, &font_sans16, "AVATAR Tokyo: WAVY", White, Black);
+    font_draw(10, 104, &font_sans12, "The quick brown fox jumps", Green, Black);
+    LCD_FillRect(0, 130, MAX_X, 30, Red);
+    font_draw_over(10, 136, &font_sans16, "senza sfondo", Yellow);
+    report("font");
+
+    /* gli stessi testi con l'antialiasing (4 e 2 bit per pixel) */
+    LCD_Clear(Black);
+    font_draw((MAX_X - font_width(&font_num48_aa, "12:34")) / 2, 20, &font_num48_aa, "12:34", White, Blue);
+    font_draw(10, 80, &font_sans16_aa, "AVATAR Tokyo: WAVY", White, Black);
+    font_draw(10, 104, &font_sans16_aa, "Giallo su rosso", Yellow, Red);
+    report("font_aa");
+
+    /* HUD ridisegnato a ogni frame dalla cache dei glifi: dopo il primo frame solo hit */
+    LCD_Clear(Black);
+    {
+        const GCACHE_Stats *st = gcache_stats();
+        char hud[32];
+        uint16_t f;
+
+        for( f = 0; f < 60; f++ ){
+            sprintf(hud, "PUNTI %06u VITE %u", (unsigned)(f * 25), 3u);
+            gcache_text(8, 8, hud, White, Blue);
+            sprintf(hud, "TEMPO %02u", (unsigned)(59 - f));
+            gcache_text(MAX_X - 8 * 8 - 8, 300, hud, Yellow, Black);
+        }
+        report("gcache");
+        printf("  %u hit, %u miss, %u slot di %u\n", (unsigned)st->hits,
+               (unsigned)st->misses, (unsigned)st->used, (unsigned)GCACHE_SLOTS);
+        check(st->hits == 1584 && st->misses == 36, "gcache: hit e miss diversi da 1584 e 36");
+    }
+
+    check(step == DEMO_STEPS, "passi mancanti rispetto a demo_expect");
+    printf("%u passi, %u errori\n", (unsigned)step, demo_errors);
+    return (demo_errors != 0) ? 1 : 0;
+}
@@ -0,0 +1,369 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           glcd_emu.cpp
+** Descriptions:        Emulatore su PC dei pin usati da GLCD.c e TouchPanel.c.
+** Ogni accesso a un IoReg arriva qui: le scritture su GPIO0 (EN, LE, DIR, CS, RS, WR, RD)
+** e GPIO2 (D0..D7) vengono decodificate come il latch della LandTiger e un ILI9325,
+** quelle su SSP1 come un ADS7843. Timer ed eventi del touch sono sostituiti da funzioni vuote.
+** Correlated files:    LPC17xx.h (host), glcd_emu.h, GLCD.h, TouchPanel.h
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "LPC17xx.h"
+#include "glcd_emu.h"
+#include "../Source/GLCD/GLCD.h"
+#include "../Source/timer/timer.h"
+#include "../Source/event/event.h"
+
+LPC_GPIO_TypeDef    emu_gpio[5];
+LPC_SSP_TypeDef     emu_ssp1;
+LPC_SC_TypeDef      emu_sc;
+LPC_PINCON_TypeDef  emu_pincon;
+LPC_GPIOINT_TypeDef emu_gpioint;
+DWT_Type            emu_dwt;
+CoreDebug_Type      emu_coredebug;
+SysTick_Type        emu_systick;
+
+uint32_t SystemCoreClock = 100000000;
+
+/* STATO DEL BUS LCD */
+static uint32_t   pin0;                 /* uscite di P0 (controlli) */
+static uint32_t   pin2;                 /* uscite di P2 (dati) */
+static uint8_t    latch;                /* D0..D7 catturati dal latch (LE) */
+static uint16_t   read_word;            /* valore messo sul bus dall'ultimo RD */
+
+/* STATO DELL'ILI9325 */
+static uint16_t   gram[EMU_GRAM_H][EMU_GRAM_W];
+static uint16_t   lcd_reg[256];
+static uint16_t   lcd_index;
+static uint16_t   ac_x, ac_y;           /* address counter */
+static uint8_t    gram_reads;           /* 1 dopo la lettura a vuoto che segue 0x22 */
+
+/* STATO DEL TOUCH */
+static uint8_t    tp_pressed;
+static uint16_t   tp_x, tp_y;
+static uint8_t    ssp_rx[8];
+static uint8_t    ssp_rx_count;
+static uint16_t   ssp_shift;            /* conversione in uscita, MSB per primo */
+static uint8_t    ssp_shift_bytes;
+
+static EMU_Counts counts;
+
+/******************************************************************************
+** ILI9325
+******************************************************************************/
+static void lcd_advance( void )
+{
+    uint16_t entry = lcd_reg[0x03];
+    uint16_t hsa = lcd_reg[0x50], hea = lcd_reg[0x51];
+    uint16_t vsa = lcd_reg[0x52], vea = lcd_reg[0x53];
+    int dx = (entry & (1 << 4)) ? 1 : -1;   /* I/D0 */
+    int dy = (entry & (1 << 5)) ? 1 : -1;   /* I/D1 */
+
+    if( (entry & (1 << 3)) == 0 ){          /* AM = 0: prima in orizzontale */
+        if( (dx > 0 && ac_x >= hea) || (dx < 0 && ac_x <= hsa) ){
+            ac_x = (dx > 0) ? hsa : hea;
+            if( (dy > 0 && ac_y >= vea) || (dy < 0 && ac_y <= vsa) ){
+                ac_y = (dy > 0) ? vsa : vea;
+            }
+            else {
+                ac_y += dy;
+            }
+        }
+        else {
+            ac_x += dx;
+        }
+    }
+    else {                                  /* AM = 1: prima in verticale */
+        if( (dy > 0 && ac_y >= vea) || (dy < 0 && ac_y <= vsa) ){
+            ac_y = (dy > 0) ? vsa : vea;
+            if( (dx > 0 && ac_x >= hea) || (dx < 0 && ac_x <= hsa) ){
+                ac_x = (dx > 0) ? hsa : hea;
+            }
+            else {
+                ac_x += dx;
+            }
+        }
+        else {
+            ac_y += dy;
+        }
+    }
+}
+
+static void lcd_write_data( uint16_t data )
+{
+    if( lcd_index == 0x22 ){
+        if( ac_x < EMU_GRAM_W && ac_y < EMU_GRAM_H ){
+            gram[ac_y][ac_x] = data;
+        }
+        counts.gram_pixels++;
+        lcd_advance();
+        return;
+    }
+
+    counts.reg_writes++;
+    lcd_reg[lcd_index & 0xFF] = data;
+    switch( lcd_index ){
+        case 0x20:  ac_x = data & 0xFF;  break;
+        case 0x21:  ac_y = data & 0x1FF; break;
+        default:    break;
+    }
+}
+
+static uint16_t lcd_read_data( void )
+{
+    uint16_t value;
+
+    if( lcd_index == 0x00 ){
+        return 0x9325;
+    }
+    if( lcd_index != 0x22 ){
+        return lcd_reg[lcd_index & 0xFF];
+    }
+    if( gram_reads == 0 ){
+        gram_reads = 1;
+        return 0;                           /* dummy read */
+    }
+    value = (ac_x < EMU_GRAM_W && ac_y < EMU_GRAM_H) ? gram[ac_y][ac_x] : 0;
+    lcd_advance();
+    /* Con BGR = 1 in 0x03 la lettura torna con rosso e blu scambiati */
+    if( lcd_reg[0x03] & (1 << 12) ){
+        value = (uint16_t)(((value & 0x1F) << 11) | (value & 0x07E0) | (value >> 11));
+    }
+    return value;
+}
+
+/******************************************************************************
+** BUS 8080 DELLA LANDTIGER
+** D0..D7 passano dal latch (trasparente con LE alto), D8..D15 arrivano
+** direttamente da P2.0..P2.7. Il controller legge il bus sul fronte di salita di WR.
+******************************************************************************/
+static void bus_update( uint32_t old0 )
+{
+    uint32_t rise = ~old0 & pin0;
+    uint32_t fall = old0 & ~pin0;
+    uint16_t word;
+
+    if( pin0 & (1 << 20) ){                 /* LE alto: latch trasparente */
+        latch = (uint8_t)pin2;
+    }
+    if( pin0 & (1 << 22) ){                 /* CS alto: controller non selezionato */
+        return;
+    }
+    if( rise & (1 << 24) ){                 /* WR */
+        word = (uint16_t)(latch | ((pin2 & 0xFF) << 8));
+        if( pin0 & (1 << 23) ){
+            counts.bus_data++;
+            lcd_write_data(word);
+        }
+        else {
+            counts.bus_index++;
+            lcd_index  = word;
+            gram_reads = 0;
+        }
+    }
+    if( fall & (1 << 25) ){                 /* RD */
+        counts.bus_reads++;
+        read_word = lcd_read_data();
+    }
+}
+
+/******************************************************************************
+** ADS7843 SU SSP1
+** Un byte di comando con il bit 7 alto avvia la conversione; i due byte
+** successivi la restituiscono allineata come la legge RD_AD (valore << 4).
+******************************************************************************/
+static void ssp_transfer( uint8_t tx )
+{
+    uint8_t rx = 0;
+
+    counts.ssp_bytes++;
+    if( ssp_shift_bytes ){
+        rx = (uint8_t)(ssp_shift >> 8);
+        ssp_shift <<= 8;
+        ssp_shift_bytes--;
+    }
+    if( tx & 0x80 ){
+        ssp_shift = (uint16_t)((((tx & 0x70) == 0x10) ? tp_x : tp_y) << 4);
+        if( !tp_pressed ){
+            ssp_shift = 0;
+        }
+        ssp_shift_bytes = 2;
+    }
+    if( ssp_rx_count < sizeof(ssp_rx) ){
+        ssp_rx[ssp_rx_count++] = rx;
+    }
+}
+
+/******************************************************************************
+** ACCESSO AI REGISTRI
+******************************************************************************/
+static int is_gpio_write( const IoReg *r, const LPC_GPIO_TypeDef *g )
+{
+    return r == &g->FIODIR || r == &g->FIOSET || r == &g->FIOCLR || r == &g->FIOPIN;
+}
+
+IoReg::operator uint32_t() const
+{
+    uint32_t v;
+
+    if( this == &LPC_GPIO2->FIOPIN0 ){
+        /* LCD_Read: EN basso -> D8..D15, EN alto -> D0..D7 */
+        return (pin0 & (1 << 19)) ? (read_word & 0xFF) : (read_word >> 8);
+    }
+    if( this == &LPC_GPIO2->FIOPIN ){
+        v = pin2 | (1 << 13);               /* TP_INT alto a riposo */
+        if( tp_pressed ){
+            v &= ~(1 << 13);
+        }
+        return v;
+    }
+    if( this == &LPC_GPIO0->FIOPIN ){
+        return pin0;
+    }
+    if( this == &DWT->CYCCNT ){
+        return ++((IoReg *)this)->value;
+    }
+    if( this == &SysTick->CTRL ){
+        return value | SysTick_CTRL_COUNTFLAG_Msk;
+    }
+    if( this == &LPC_SSP1->SR ){
+        return ssp_rx_count ? (1 << 2) : 0; /* RNE, mai BSY */
+    }
+    if( this == &LPC_SSP1->DR ){
+        if( ssp_rx_count == 0 ){
+            return 0;
+        }
+        v = ssp_rx[0];
+        memmove(ssp_rx, ssp_rx + 1, --ssp_rx_count);
+        return v;
+    }
+    return value;
+}
+
+IoReg &IoReg::operator=( uint32_t v )
+{
+    uint32_t old0 = pin0;
+
+    value = v;
+
+    if( is_gpio_write(this, LPC_GPIO0) ){
+        counts.gpio_writes++;
+        if( this == &LPC_GPIO0->FIOSET )      pin0 |= v;
+        else if( this == &LPC_GPIO0->FIOCLR ) pin0 &= ~v;
+        else if( this == &LPC_GPIO0->FIOPIN ) pin0 = v;
+        bus_update(old0);
+    }
+    else if( is_gpio_write(this, LPC_GPIO2) ){
+        counts.gpio_writes++;
+        if( this == &LPC_GPIO2->FIOSET )      pin2 |= v;
+        else if( this == &LPC_GPIO2->FIOCLR ) pin2 &= ~v;
+        else if( this == &LPC_GPIO2->FIOPIN ) pin2 = v;
+        bus_update(pin0);
+    }
+    else if( this == &LPC_SSP1->DR ){
+        ssp_transfer((uint8_t)v);
+    }
+    return *this;
+}
+
+/******************************************************************************
+** TIMER ED EVENTI DEL TOUCH: su PC non c'e' nessun interrupt
+******************************************************************************/
+uint32_t init_timer( uint8_t timer_num, uint32_t Prescaler, uint8_t MatchReg, uint8_t SRImatchReg, uint32_t TimerInterval )
+{
+    (void)timer_num; (void)Prescaler; (void)MatchReg; (void)SRImatchReg; (void)TimerInterval;
+    return 0;
+}
+void enable_timer( uint8_t timer_num )  { (void)timer_num; }
+void disable_timer( uint8_t timer_num ) { (void)timer_num; }
+void reset_timer( uint8_t timer_num )   { (void)timer_num; }
+
+uint8_t event_post( uint8_t source, uint8_t code, uint32_t data )
+{
+    (void)source; (void)code; (void)data;
+    counts.events++;
+    return 1;
+}
+
+/******************************************************************************
+** API DELL'EMULATORE
+******************************************************************************/
+void emu_reset( void )
+{
+    memset(gram, 0, sizeof(gram));
+    memset(lcd_reg, 0, sizeof(lcd_reg));
+    lcd_reg[0x51] = EMU_GRAM_W - 1;
+    lcd_reg[0x53] = EMU_GRAM_H - 1;
+    lcd_reg[0x03] = (1 << 5) | (1 << 4);
+    pin0 = pin2 = 0;
+    latch = 0;
+    lcd_index = 0;
+    ac_x = ac_y = 0;
+    tp_pressed = 0;
+    ssp_rx_count = 0;
+    ssp_shift_bytes = 0;
+    emu_counts_clear();
+}
+
+void emu_counts_clear( void )
+{
+    memset(&counts, 0, sizeof(counts));
+}
+
+const EMU_Counts *emu_counts( void )
+{
+    return &counts;
+}
+
+uint16_t emu_gram_pixel( uint16_t x, uint16_t y )
+{
+    return (x < EMU_GRAM_W && y < EMU_GRAM_H) ? gram[y][x] : 0;
+}
+
+uint32_t emu_gram_hash( void )
+{
+    const uint8_t *p = (const uint8_t *)gram;
+    uint32_t h = 2166136261u;
+    size_t i;
+
+    for( i = 0; i < sizeof(gram); i++ ){
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+/* Il pannello mostra la GRAM a partire dalla riga 0x6A se VLE (0x61 bit 1) e' attivo */
+int emu_dump_ppm( const char *path )
+{
+    FILE *f = fopen(path, "wb");
+    uint16_t x, y, row, c;
+    uint8_t rgb[3];
+
+    if( f == NULL ){
+        return -1;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", EMU_GRAM_W, EMU_GRAM_H);
+    for( y = 0; y < EMU_GRAM_H; y++ ){
+        row = y;
+        if( lcd_reg[0x61] & (1 << 1) ){
+            row = (uint16_t)((y + lcd_reg[0x6A]) % EMU_GRAM_H);
+        }
+        for( x = 0; x < EMU_GRAM_W; x++ ){
+            c = gram[row][x];
+            rgb[0] = (uint8_t)(((c >> 11) & 0x1F) * 255 / 31);
+            rgb[1] = (uint8_t)(((c >> 5) & 0x3F) * 255 / 63);
+            rgb[2] = (uint8_t)((c & 0x1F) * 255 / 31);
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    return fclose(f);
+}
+
+void emu_touch( int pressed, uint16_t x_raw, uint16_t y_raw )
+{
+    tp_pressed = pressed ? 1 : 0;
+    tp_x = x_raw & 0xFFF;
+    tp_y = y_raw & 0xFFF;
+}
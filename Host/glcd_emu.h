@@ -0,0 +1,46 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           glcd_emu.h
+** Descriptions:        Emulatore su PC del bus LCD (ILI9325 su latch 8080) e del touch ADS7843 (SSP1)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __GLCD_EMU_H
+#define __GLCD_EMU_H
+
+#include "LPC17xx.h"
+
+/* Dimensione della GRAM dell'ILI9325 (orientamento nativo) */
+#define EMU_GRAM_W      240
+#define EMU_GRAM_H      320
+
+typedef struct {
+    uint32_t gpio_writes;   /* scritture su registri GPIO0/GPIO2 (FIODIR, FIOSET, FIOCLR, FIOPIN) */
+    uint32_t bus_index;     /* cicli WR con RS = 0 (indice di registro) */
+    uint32_t bus_data;      /* cicli WR con RS = 1 */
+    uint32_t bus_reads;     /* cicli RD */
+    uint32_t reg_writes;    /* scritture di registri diversi da 0x22 */
+    uint32_t gram_pixels;   /* pixel scritti in GRAM */
+    uint32_t ssp_bytes;     /* byte trasferiti su SSP1 */
+    uint32_t events;        /* chiamate a event_post */
+} EMU_Counts;
+
+/* Accensione: GRAM nera, registri e contatori a zero, penna sollevata */
+extern void emu_reset( void );
+
+/* Azzera i contatori (da chiamare prima di ogni primitiva da misurare) */
+extern void emu_counts_clear( void );
+extern const EMU_Counts *emu_counts( void );
+
+/* Pixel della GRAM come scritto dal firmware (RGB565) */
+extern uint16_t emu_gram_pixel( uint16_t x, uint16_t y );
+
+/* FNV-1a della GRAM: confronto rapido con un'immagine di riferimento */
+extern uint32_t emu_gram_hash( void );
+
+/* Salva la GRAM come PPM binario (P6). Ritorna 0 se ok */
+extern int emu_dump_ppm( const char *path );
+
+/* Penna giu' (pressed = 1) con le letture grezze del ADS7843, oppure sollevata */
+extern void emu_touch( int pressed, uint16_t x_raw, uint16_t y_raw );
+
+#endif /* end __GLCD_EMU_H */
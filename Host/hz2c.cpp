@@ -0,0 +1,293 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           hz2c.cpp
+** Descriptions:        Generatore del font cinese compresso (hzfont.h) a partire da HzLib.c: tiene solo
+** i caratteri che compaiono nei file indicati, li comprime (rettangolo pieno + righe ripetute) e scrive
+** gli indici ordinati per codice Unicode e GB2312. I file si leggono come UTF-8, con -g come GBK
+** (sorgenti salvati da uVision con la codepage cinese).
+**
+** Compilazione (dalla cartella del progetto):
+**   g++ -O2 -IHost Host/hz2c.cpp -o hz2c
+** Uso:
+**   ./hz2c [-g] Source/GLCD/HzLib.c hz_font file... > Source/hzfont/hz_font.c
+** Correlated files:    hzfont.h, lib_hzfont.c, HzLib.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iconv.h>
+#include <map>
+#include <vector>
+#include "LPC17xx.h"
+#include "../Source/hzfont/hzfont.h"
+
+#define HZ_ROWS     94                  /* caratteri per riga della tabella GB2312 */
+#define HZ_FIRST    0xB0A1              /* primo carattere di HzLib (area dei caratteri cinesi) */
+
+typedef std::vector<uint8_t> Bytes;
+
+static std::vector<uint16_t>     hzlib;  /* 16 righe per glifo, glifo g = codice HZ_FIRST + ... */
+static std::map<uint16_t, int>   ucs2glyph;
+static std::map<uint16_t, uint16_t> gb2ucs;
+
+/******************************************************************************
+** Function name:       gb_code
+** Descriptions:        Codice GB2312 del glifo g di HzLib.
+******************************************************************************/
+static uint16_t gb_code( int g )
+{
+    return (uint16_t)(((HZ_FIRST >> 8) + g / HZ_ROWS) << 8 | ((HZ_FIRST & 0xFF) + g % HZ_ROWS));
+}
+
+/******************************************************************************
+** Function name:       load_hzlib
+** Descriptions:        Legge i valori esadecimali della tabella HzLib[][] e costruisce
+**                      la corrispondenza Unicode -> glifo con iconv.
+******************************************************************************/
+static int load_hzlib( const char *path )
+{
+    FILE *f = fopen(path, "rb");
+    std::vector<char> txt;
+    std::vector<uint8_t> v;
+    char *p, *e, in[2], out[4], *pi, *po;
+    size_t ni, no;
+    iconv_t cd;
+    int c, g;
+
+    if( f == NULL ){
+        return -1;
+    }
+    while( (c = fgetc(f)) != EOF ){
+        txt.push_back((char)c);
+    }
+    fclose(f);
+    txt.push_back(0);
+
+    p = strstr(&txt[0], "HzLib[");
+    p = p ? strchr(p, '{') : NULL;
+    e = p ? strstr(p, "};") : NULL;     /* dopo la tabella c'e' GetGBKCode, con altri 0x.. */
+    if( e == NULL ){
+        return -1;
+    }
+    *e = 0;
+    while( (p = strstr(p, "0x")) != NULL ){
+        v.push_back((uint8_t)strtoul(p, &p, 16));
+    }
+    if( v.size() % 32 != 0 ){
+        return -1;
+    }
+    for( size_t i = 0; i < v.size(); i += 2 ){
+        hzlib.push_back((uint16_t)(v[i] << 8 | v[i + 1]));
+    }
+
+    cd = iconv_open("UCS-2BE", "GB2312");
+    if( cd == (iconv_t)-1 ){
+        return -1;
+    }
+    for( g = 0; g < (int)hzlib.size() / HZ_SIZE; g++ ){
+        in[0] = (char)(gb_code(g) >> 8);
+        in[1] = (char)gb_code(g);
+        pi = in; ni = 2; po = out; no = sizeof(out);
+        if( iconv(cd, &pi, &ni, &po, &no) != (size_t)-1 && no == 2 ){
+            ucs2glyph[(uint16_t)((uint8_t)out[0] << 8 | (uint8_t)out[1])] = g;
+            gb2ucs[gb_code(g)] = (uint16_t)((uint8_t)out[0] << 8 | (uint8_t)out[1]);
+        }
+    }
+    iconv_close(cd);
+    return 0;
+}
+
+/******************************************************************************
+** Function name:       scan_file
+** Descriptions:        Aggiunge a used i glifi dei caratteri del file.
+******************************************************************************/
+static int scan_file( const char *path, int gbk, std::map<uint16_t, int> &used )
+{
+    FILE *f = fopen(path, "rb");
+    std::vector<uint8_t> b;
+    uint32_t cp;
+    size_t i, k, n;
+    int c;
+
+    if( f == NULL ){
+        return -1;
+    }
+    while( (c = fgetc(f)) != EOF ){
+        b.push_back((uint8_t)c);
+    }
+    fclose(f);
+
+    for( i = 0; i < b.size(); i++ ){
+        if( b[i] < 0x80 ){
+            continue;
+        }
+        if( gbk ){
+            if( i + 1 < b.size() && gb2ucs.count((uint16_t)(b[i] << 8 | b[i + 1])) ){
+                cp = gb2ucs[(uint16_t)(b[i] << 8 | b[i + 1])];
+                used[(uint16_t)cp] = ucs2glyph[(uint16_t)cp];
+            }
+            i++;                        /* i byte alti GBK vanno sempre in coppia */
+            continue;
+        }
+        /* UTF-8: sequenze non valide (file Latin-1) saltate */
+        n = (b[i] >= 0xF0) ? 3 : (b[i] >= 0xE0) ? 2 : (b[i] >= 0xC0) ? 1 : 0;
+        if( n == 0 || i + n >= b.size() ){
+            continue;
+        }
+        cp = b[i] & (0x3F >> n);
+        for( k = 1; k <= n && (b[i + k] & 0xC0) == 0x80; k++ ){
+            cp = cp << 6 | (b[i + k] & 0x3F);
+        }
+        if( k <= n ){
+            continue;
+        }
+        i += n;
+        if( ucs2glyph.count((uint16_t)cp) && cp <= 0xFFFF ){
+            used[(uint16_t)cp] = ucs2glyph[(uint16_t)cp];
+        }else if( cp >= 0x3000 ){
+            fprintf(stderr, "%s: U+%04X non e' in HzLib, ignorato\n", path, (unsigned)cp);
+        }
+    }
+    return 0;
+}
+
+/******************************************************************************
+** Function name:       put_bits
+** Descriptions:        Accoda k bit (dal piu' significativo) a un flusso di byte.
+******************************************************************************/
+static void put_bits( Bytes &out, int &nbits, uint32_t v, int k )
+{
+    while( k-- ){
+        if( nbits % 8 == 0 ){
+            out.push_back(0);
+        }
+        if( (v >> k) & 1 ){
+            out.back() |= 0x80 >> (nbits % 8);
+        }
+        nbits++;
+    }
+}
+
+/******************************************************************************
+** Function name:       encode
+** Descriptions:        Comprime il glifo g come descritto in hzfont.h.
+******************************************************************************/
+static Bytes encode( int g )
+{
+    const uint16_t *r = &hzlib[g * HZ_SIZE];
+    uint16_t all = 0, prev = 0;
+    int top = -1, bot = 0, left = 0, right = 0, y, nbits = 0;
+    Bytes out;
+
+    for( y = 0; y < HZ_SIZE; y++ ){
+        all |= r[y];
+        if( r[y] ){
+            top = (top < 0) ? y : top;
+            bot = y;
+        }
+    }
+    if( top < 0 ){
+        out.push_back(HZ_EMPTY);
+        return out;
+    }
+    while( !(all & (0x8000 >> left)) ) left++;
+    right = HZ_SIZE - 1;
+    while( !(all & (0x8000 >> right)) ) right--;
+
+    out.push_back((uint8_t)(top << 4 | (bot - top)));
+    out.push_back((uint8_t)(left << 4 | (right - left)));
+    nbits = 16;
+    for( y = top; y <= bot; y++ ){
+        if( y != top ){
+            put_bits(out, nbits, r[y] != prev, 1);
+        }
+        if( y == top || r[y] != prev ){
+            put_bits(out, nbits, r[y] >> (HZ_SIZE - 1 - right), right - left + 1);
+        }
+        prev = r[y];
+    }
+    return out;
+}
+
+/******************************************************************************
+** Function name:       print_u16
+** Descriptions:        Un array const uint16_t.
+******************************************************************************/
+static void print_u16( const char *name, const char *suffix, const std::vector<uint16_t> &v )
+{
+    size_t i;
+
+    printf("static const uint16_t %s_%s[%u] = {", name, suffix, (unsigned)v.size());
+    for( i = 0; i < v.size(); i++ ){
+        printf("%s0x%04x,", (i % 10) ? " " : "\n    ", v[i]);
+    }
+    printf("\n};\n\n");
+}
+
+int main( int argc, char **argv )
+{
+    std::map<uint16_t, int> used;           /* Unicode -> glifo di HzLib, ordinato */
+    std::map<uint16_t, uint16_t> gb;        /* GB2312 -> glifo del font, ordinato */
+    std::vector<uint16_t> ucs, gbk, gb_glyph, offset;
+    Bytes data, e;
+    int a = 1, gbk_in = 0, i;
+
+    if( argc > 1 && strcmp(argv[1], "-g") == 0 ){
+        gbk_in = 1;
+        a++;
+    }
+    if( argc - a < 3 ){
+        fprintf(stderr, "uso: %s [-g] HzLib.c nome_font file...\n", argv[0]);
+        return 2;
+    }
+    if( load_hzlib(argv[a]) != 0 ){
+        fprintf(stderr, "%s: tabella HzLib non trovata\n", argv[a]);
+        return 1;
+    }
+    for( i = a + 2; i < argc; i++ ){
+        if( scan_file(argv[i], gbk_in, used) != 0 ){
+            fprintf(stderr, "%s: impossibile leggere\n", argv[i]);
+            return 1;
+        }
+    }
+
+    for( std::map<uint16_t, int>::iterator it = used.begin(); it != used.end(); ++it ){
+        gb[gb_code(it->second)] = (uint16_t)ucs.size();
+        ucs.push_back(it->first);
+        offset.push_back((uint16_t)data.size());
+        e = encode(it->second);
+        data.insert(data.end(), e.begin(), e.end());
+        if( data.size() > 0xFFFF ){
+            fprintf(stderr, "troppi caratteri: i dati superano 64 KB\n");
+            return 1;
+        }
+    }
+    if( ucs.empty() ){
+        fprintf(stderr, "nessun carattere di HzLib nei file\n");
+        return 1;
+    }
+    offset.push_back((uint16_t)data.size());
+    for( std::map<uint16_t, uint16_t>::iterator it = gb.begin(); it != gb.end(); ++it ){
+        gbk.push_back(it->first);
+        gb_glyph.push_back(it->second);
+    }
+
+    printf("/* Generato da Host/hz2c.cpp: %u caratteri di HzLib, %u -> %u byte (+ %u di indici) */\n",
+           (unsigned)ucs.size(), (unsigned)ucs.size() * 32, (unsigned)data.size(),
+           (unsigned)(ucs.size() * 6 + offset.size() * 2));
+    printf("#include \"hzfont.h\"\n\n");
+    print_u16(argv[a + 1], "ucs", ucs);
+    print_u16(argv[a + 1], "gb", gbk);
+    print_u16(argv[a + 1], "gb_glyph", gb_glyph);
+    print_u16(argv[a + 1], "offset", offset);
+    printf("static const uint8_t %s_data[%u] = {", argv[a + 1], (unsigned)data.size());
+    for( size_t k = 0; k < data.size(); k++ ){
+        printf("%s0x%02x,", (k % 16) ? " " : "\n    ", data[k]);
+    }
+    printf("\n};\n\n");
+    printf("extern const HZ_Font %s;\n\n", argv[a + 1]);
+    printf("const HZ_Font %s = { %u, %s_ucs, %s_gb, %s_gb_glyph, %s_offset, %s_data };\n",
+           argv[a + 1], (unsigned)ucs.size(), argv[a + 1], argv[a + 1], argv[a + 1], argv[a + 1], argv[a + 1]);
+    return 0;
+}
@@ -0,0 +1,215 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           img2c.cpp
+** Descriptions:        Convertitore offline PPM (P6, 8 bit) -> immagine Q5 come array C per image_draw.
+** Codifica l'immagine con e senza palette (la palette solo se ha al massimo 64 colori)
+** e tiene la versione piu' corta. Il formato e' descritto in Source/image/image.h.
+**
+** Compilazione (dalla cartella del progetto):
+**   g++ -O2 -IHost Host/img2c.cpp -o img2c
+** Uso:
+**   ./img2c logo.ppm logo > Source/image/img_logo.c
+** e nel firmware:  extern const uint8_t logo[];  image_draw(x, y, logo);
+** Correlated files:    image.h, lib_image.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "LPC17xx.h"
+#include "../Source/image/image.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+/******************************************************************************
+** Function name:       ppm_token
+** Descriptions:        Prossimo numero dell'intestazione PPM (salta spazi e commenti).
+******************************************************************************/
+static int ppm_token( FILE *f )
+{
+    int c, v = 0;
+
+    do{
+        c = fgetc(f);
+        if( c == '#' ){
+            while( c != '\n' && c != EOF ){
+                c = fgetc(f);
+            }
+        }
+    }while( c == ' ' || c == '\t' || c == '\r' || c == '\n' );
+
+    if( c < '0' || c > '9' ){
+        return -1;
+    }
+    while( c >= '0' && c <= '9' ){
+        v = v * 10 + (c - '0');
+        c = fgetc(f);
+    }
+    return v;                       /* c e' il singolo spazio prima dei dati */
+}
+
+/******************************************************************************
+** Function name:       ppm_load
+** Descriptions:        Legge un PPM P6 e lo converte in RGB565 (come RGB565CONVERT).
+******************************************************************************/
+static int ppm_load( const char *path, std::vector<uint16_t> &px, int *w, int *h )
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t rgb[3];
+    int maxval, i;
+
+    if( f == NULL ){
+        return -1;
+    }
+    if( fgetc(f) != 'P' || fgetc(f) != '6' ){
+        fclose(f);
+        return -1;
+    }
+    *w = ppm_token(f);
+    *h = ppm_token(f);
+    maxval = ppm_token(f);
+    if( *w <= 0 || *h <= 0 || *w > 0xFFFF || *h > 0xFFFF || maxval != 255 ){
+        fclose(f);
+        return -1;
+    }
+    px.resize((size_t)*w * *h);
+    for( i = 0; i < *w * *h; i++ ){
+        if( fread(rgb, 1, 3, f) != 3 ){
+            fclose(f);
+            return -1;
+        }
+        px[i] = RGB565CONVERT(rgb[0], rgb[1], rgb[2]);
+    }
+    fclose(f);
+    return 0;
+}
+
+/******************************************************************************
+** Function name:       put_run
+** Descriptions:        Ripetizioni dell'ultimo pixel, a blocchi di 65536.
+******************************************************************************/
+static void put_run( Bytes &out, uint32_t run )
+{
+    uint32_t n;
+
+    while( run != 0 ){
+        n = (run > 65536) ? 65536 : run;
+        if( n <= 62 ){
+            out.push_back((uint8_t)(IMAGE_OP_RUN | (n - 1)));
+        }else{
+            out.push_back(IMAGE_OP_RUN16);
+            out.push_back((uint8_t)((n - 1) >> 8));
+            out.push_back((uint8_t)(n - 1));
+        }
+        run -= n;
+    }
+}
+
+/******************************************************************************
+** Function name:       encode
+** Descriptions:        Codifica Q5. Con una palette (al massimo 64 colori) la
+**                      tabella resta fissa e si usano solo INDEX e RUN; senza,
+**                      la tabella segue i colori recenti come nel decoder.
+******************************************************************************/
+static Bytes encode( const std::vector<uint16_t> &px, int w, int h, const std::vector<uint16_t> &pal )
+{
+    Bytes out;
+    uint16_t tab[IMAGE_TAB], prev = 0, p;
+    uint32_t run = 0;
+    int dr, dg, db;
+    size_t i, j;
+
+    out.push_back('Q');
+    out.push_back('5');
+    out.push_back((uint8_t)w);
+    out.push_back((uint8_t)(w >> 8));
+    out.push_back((uint8_t)h);
+    out.push_back((uint8_t)(h >> 8));
+    out.push_back((uint8_t)pal.size());
+    memset(tab, 0, sizeof(tab));
+    for( j = 0; j < pal.size(); j++ ){
+        tab[j] = pal[j];
+        out.push_back((uint8_t)pal[j]);
+        out.push_back((uint8_t)(pal[j] >> 8));
+    }
+
+    for( i = 0; i < px.size(); i++ ){
+        p = px[i];
+        if( p == prev ){
+            run++;
+            continue;
+        }
+        put_run(out, run);
+        run = 0;
+
+        if( !pal.empty() ){
+            for( j = 0; pal[j] != p; j++ );
+            out.push_back((uint8_t)(IMAGE_OP_INDEX | j));
+        }else if( tab[IMAGE_HASH(p)] == p ){
+            out.push_back((uint8_t)(IMAGE_OP_INDEX | IMAGE_HASH(p)));
+        }else{
+            tab[IMAGE_HASH(p)] = p;
+            dr = (((p >> 11) - (prev >> 11) + 16) & 0x1f) - 16;
+            dg = ((((p >> 5) & 0x3f) - ((prev >> 5) & 0x3f) + 32) & 0x3f) - 32;
+            db = (((p & 0x1f) - (prev & 0x1f) + 16) & 0x1f) - 16;
+            if( dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1 ){
+                out.push_back((uint8_t)(IMAGE_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+            }else if( dr >= -8 && dr <= 7 && db >= -8 && db <= 7 ){
+                out.push_back((uint8_t)(IMAGE_OP_LUMA | (dg + 32)));
+                out.push_back((uint8_t)((dr + 8) << 4 | (db + 8)));
+            }else{
+                out.push_back(IMAGE_OP_RGB);
+                out.push_back((uint8_t)(p >> 8));
+                out.push_back((uint8_t)p);
+            }
+        }
+        prev = p;
+    }
+    put_run(out, run);
+    return out;
+}
+
+int main( int argc, char **argv )
+{
+    std::vector<uint16_t> px, pal, none;
+    Bytes best, q;
+    size_t i, j;
+    int w, h;
+
+    if( argc != 3 ){
+        fprintf(stderr, "uso: %s immagine.ppm nome_array\n", argv[0]);
+        return 2;
+    }
+    if( ppm_load(argv[1], px, &w, &h) != 0 ){
+        fprintf(stderr, "%s: serve un PPM P6 con maxval 255\n", argv[1]);
+        return 1;
+    }
+
+    /* Palette: i colori in ordine di apparizione, se sono al massimo 64 */
+    for( i = 0; i < px.size() && pal.size() <= IMAGE_TAB; i++ ){
+        for( j = 0; j < pal.size() && pal[j] != px[i]; j++ );
+        if( j == pal.size() ){
+            pal.push_back(px[i]);
+        }
+    }
+    best = encode(px, w, h, none);
+    if( pal.size() <= IMAGE_TAB ){
+        q = encode(px, w, h, pal);
+        if( q.size() < best.size() ){
+            best = q;
+        }
+    }
+
+    printf("/* Generato da Host/img2c.cpp: %s, %dx%d, %s, %u -> %u byte */\n",
+           argv[1], w, h, best[6] ? "palette" : "senza palette",
+           (unsigned)(px.size() * 2), (unsigned)best.size());
+    printf("#include <stdint.h>\n\n");
+    printf("extern const uint8_t %s[];\n\n", argv[2]);         /* in C++ const sarebbe static */
+    printf("const uint8_t %s[%u] = {", argv[2], (unsigned)best.size());
+    for( i = 0; i < best.size(); i++ ){
+        printf("%s0x%02x,", (i % 16) ? " " : "\n    ", best[i]);
+    }
+    printf("\n};\n");
+    return 0;
+}
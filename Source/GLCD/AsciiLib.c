@@ -430,6 +430,23 @@ void GetASCIICode(unsigned char* pBuffer,unsigned char ASCII)
    memcpy(pBuffer,AsciiLib[(ASCII - 32)] ,16);
 }
 
+/*******************************************************************************
+* Function Name  : GetASCIIGlyph
+* Description    : Returns a pointer to the 16 bitmap rows of a character
+* Input          : - ASCII: character code, e.g. 'A'
+* Output         : None
+* Return         : 16 rows, MSB is the leftmost pixel
+* Attention		 : Non printable codes map to ' '. No copy is made.
+*******************************************************************************/
+const unsigned char *GetASCIIGlyph(unsigned char ASCII)
+{
+   if( ASCII < 32 || ASCII > 126 )
+   {
+      ASCII = ' ';
+   }
+   return AsciiLib[(ASCII - 32)];
+}
+
 
 /*********************************************************************************************************
       END FILE
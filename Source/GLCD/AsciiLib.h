@@ -31,6 +31,7 @@
 
 /* Private function prototypes -----------------------------------------------*/
 void GetASCIICode(unsigned char* pBuffer,unsigned char ASCII);
+const unsigned char *GetASCIIGlyph(unsigned char ASCII);
 
 #endif 
 
@@ -22,12 +22,47 @@
 /* Includes ------------------------------------------------------------------*/
 #include "GLCD.h" 
 #include "AsciiLib.h"
+#include "../delay/delay.h"
 #include <stdbool.h>
 #include <stdio.h> /*for sprintf*/
 
+/* LCD_BeginPixels and its users (text, images, fonts, sprites, fb, scene)
+   stream pixels row by row: with 90/270 the GRAM rows are screen columns
+   and everything would be drawn transposed. */
+#if ( DISP_ORIENTATION != 0 ) && ( DISP_ORIENTATION != 180 )
+#error "GLCD: LCD_BeginPixels streams GRAM windows by rows, DISP_ORIENTATION 0 or 180 required"
+#endif
+
 /* Private variables ---------------------------------------------------------*/
 static uint8_t LCD_Code;
 
+/* Bus shadow: valid only while CS is low (one transaction). Inside it P2.0-7
+   are owned by the LCD, so the last word is still on the latch and on P2. */
+static uint8_t  LCD_BusValid;
+static uint16_t LCD_BusWord;
+
+/* Pixel burst: every LCD_RELATCH pixels D8..D15 are driven again on P2.0-7,
+   so an ISR writing the LEDs spoils at most LCD_RELATCH pixels (see
+   LCD_Relatch). A fixed count, not the row: narrow windows (vertical lines,
+   circle spans) would pay a write per pixel. */
+#define LCD_RELATCH   64
+static uint16_t LCD_RelatchLeft;
+
+/* Clip stack: entry 0 is the screen, LCD_Clip the current rectangle.
+   Pushes beyond LCD_CLIP_DEPTH are only counted, so pops still match. */
+static LCD_Rect LCD_ClipStack[LCD_CLIP_DEPTH + 1] = { { 0, 0, MAX_X - 1, MAX_Y - 1 } };
+static uint8_t  LCD_ClipTop;
+static uint8_t  LCD_ClipLost;
+
+#define LCD_Clip    ( LCD_ClipStack[LCD_ClipTop] )
+
+#ifdef GLCD_BENCH
+uint32_t LCD_BusWrites;
+#define LCD_BUS_COUNT()   (LCD_BusWrites++)
+#else
+#define LCD_BUS_COUNT()
+#endif
+
 /* Private define ------------------------------------------------------------*/
 #define  ILI9320    0  /* 0x9320 */
 #define  ILI9325    1  /* 0x9325 */
@@ -65,35 +100,73 @@ static void LCD_Configuration(void)
 
 /*******************************************************************************
 * Function Name  : LCD_Send
-* Description    : LCDд
+* Description    : Puts a 16 bit word on the bus
 * Input          : - byte: byte to be sent
 * Output         : None
 * Return         : None
-* Attention		 : None
+* Attention		 : Direction and EN are set once per transaction, and a word
+*                  already on the bus is not sent again (see LCD_BusValid).
 *******************************************************************************/
 static __attribute__((always_inline)) void LCD_Send (uint16_t byte) 
 {
-	LPC_GPIO2->FIODIR |= 0xFF;          /* P2.0...P2.7 Output */
-	LCD_DIR(1)		   				    				/* Interface A->B */
-	LCD_EN(0)	                        	/* Enable 2A->2B */
+	if( LCD_BusValid )
+	{
+		if( byte == LCD_BusWord )
+		{
+			return;
+		}
+	}
+	else
+	{
+		LPC_GPIO2->FIODIR |= 0xFF;          /* P2.0...P2.7 Output */
+		LCD_DIR(1)		   				    				/* Interface A->B */
+		LCD_EN(0)	                        	/* Enable 2A->2B */
+		LCD_BusValid = 1;
+	}
 	LPC_GPIO2->FIOPIN =  byte;          /* Write D0..D7 */
 	LCD_LE(1)                         
 	LCD_LE(0)														/* latch D0..D7	*/
 	LPC_GPIO2->FIOPIN =  byte >> 8;     /* Write D8..D15 */
+	LCD_BusWord = byte;
 }
 
+/* ILI9325 8080 bus timing, datasheet minimums in ns (see delay.h DELAY_NS).
+   Read access includes ~20 ns through the 74HC245 buffers. */
+#define LCD_T_PWLW    50    /* WR low pulse width */
+#define LCD_T_PWHW    50    /* WR high pulse width */
+#define LCD_T_RDD    120    /* read data valid after EN switch (tRDD 100 + buffer) */
+#define LCD_T_RATFM  360    /* GRAM read access time after RD low (tRATFM 340 + buffer) */
+#define LCD_T_RDHFM   90    /* RD high between GRAM reads */
+
 /*******************************************************************************
-* Function Name  : wait_delay
-* Description    : Delay Time
-* Input          : - nCount: Delay Time
+* Function Name  : LCD_Deselect
+* Description    : Ends a transaction: CS high, bus shadow no longer valid
+* Input          : None
 * Output         : None
 * Return         : None
+* Attention		 : None
+*******************************************************************************/
+static __attribute__((always_inline)) void LCD_Deselect (void) 
+{
+	LCD_CS(1);
+	LCD_BusValid = 0;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_PulseWR
+* Description    : Strobes the word already on the bus into the controller
+* Input          : None
+* Output         : None
 * Return         : None
-* Attention		 : None 
+* Attention		 : None
 *******************************************************************************/
-static void wait_delay(int count)
+static __attribute__((always_inline)) void LCD_PulseWR (void) 
 {
-	while(count--);
+	LCD_BUS_COUNT();
+	LCD_WR(0);
+	DELAY_NS(LCD_T_PWLW);
+	LCD_WR(1);
+	DELAY_NS(LCD_T_PWHW);
 }
 
 /*******************************************************************************
@@ -108,13 +181,14 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 {
 	uint16_t value;
 	
+	LCD_BusValid = 0;
 	LPC_GPIO2->FIODIR &= ~(0xFF);              /* P2.0...P2.7 Input */
 	LCD_DIR(0);		   				           				 /* Interface B->A */
 	LCD_EN(0);	                               /* Enable 2B->2A */
-	wait_delay(30);							   						 /* delay some times */     //delay software per mantenere i tempi richiesti 
+	DELAY_NS(LCD_T_RDD);											 /* data valid */
 	value = LPC_GPIO2->FIOPIN0;                /* Read D8..D15 */
 	LCD_EN(1);	                               /* Enable 1B->1A */
-	wait_delay(30);							   						 /* delay some times */
+	DELAY_NS(LCD_T_RDD);
 	value = (value << 8) | LPC_GPIO2->FIOPIN0; /* Read D0..D7 */
 	LCD_DIR(1);
 	return  value;
@@ -134,11 +208,8 @@ static __attribute__((always_inline)) void LCD_WriteIndex(uint16_t index)
 	LCD_RS(0);
 	LCD_RD(1);
 	LCD_Send( index ); 
-	wait_delay(22);	
-	LCD_WR(0);  
-	wait_delay(1);
-	LCD_WR(1);
-	LCD_CS(1);
+	LCD_PulseWR();
+	LCD_Deselect();
 }
 
 /*******************************************************************************
@@ -154,10 +225,42 @@ static __attribute__((always_inline)) void LCD_WriteData(uint16_t data)
 	LCD_CS(0);
 	LCD_RS(1);   
 	LCD_Send( data );
-	LCD_WR(0);     
-	wait_delay(1);
-	LCD_WR(1);
-	LCD_CS(1);
+	LCD_PulseWR();
+	LCD_Deselect();
+}
+
+/*******************************************************************************
+* Function Name  : LCD_Relatch
+* Description    : Drives the high byte of the bus word on P2.0-7 again. It is
+*                  called every LCD_RELATCH pixels of a burst, so an ISR write
+*                  to P2.0-7 (LEDs) spoils at most LCD_RELATCH (64) pixels.
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Only inside a burst (CS low, LCD_BusValid set)
+*******************************************************************************/
+static void LCD_Relatch(void)
+{
+	LCD_RelatchLeft = LCD_RELATCH;
+	LPC_GPIO2->FIOPIN = LCD_BusWord >> 8;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_WriteGRAM
+* Description    : Writes one pixel inside an open 0x22 burst
+* Input          : - data: RGB565 color
+* Output         : None
+* Return         : None
+* Attention		 : CS must be low and RS high (see LCD_BeginPixels)
+*******************************************************************************/
+static __attribute__((always_inline)) void LCD_WriteGRAM(uint16_t data)
+{
+	LCD_Send( data );
+	LCD_PulseWR();
+	if( --LCD_RelatchLeft == 0 )
+	{
+		LCD_Relatch();
+	}
 }
 
 /*******************************************************************************
@@ -179,7 +282,7 @@ static __attribute__((always_inline)) uint16_t LCD_ReadData(void)
 	value = LCD_Read();
 	
 	LCD_RD(1);
-	LCD_CS(1);
+	LCD_Deselect();
 	
 	return value;
 }
@@ -271,22 +374,80 @@ static void LCD_SetCursor(uint16_t Xpos,uint16_t Ypos)
 }
 
 /*******************************************************************************
-* Function Name  : LCD_Delay
-* Description    : Delay Time
-* Input          : - nCount: Delay Time
+* Function Name  : LCD_SetWindow
+* Description    : Sets the GRAM access window and moves the cursor to its
+*                  top-left corner. Following 0x22 writes auto-increment inside
+*                  the window and wrap at its end.
+* Input          : - Xstart, Ystart: top-left corner (inclusive)
+*                  - Xend, Yend: bottom-right corner (inclusive)
 * Output         : None
 * Return         : None
+* Attention		 : Coordinates must already be clipped to MAX_X/MAX_Y.
+*                  Pixel order inside the window is row-major (only
+*                  DISP_ORIENTATION 0 and 180 are built, see the #error).
+*******************************************************************************/
+static void LCD_SetWindow(uint16_t Xstart,uint16_t Ystart,uint16_t Xend,uint16_t Yend)
+{
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+
+	uint16_t Hstart = Ystart, Hend = Yend;
+	uint16_t Vstart = ( MAX_X - 1 ) - Xend, Vend = ( MAX_X - 1 ) - Xstart;
+
+	#elif  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+
+	uint16_t Hstart = Xstart, Hend = Xend;
+	uint16_t Vstart = Ystart, Vend = Yend;
+
+	#endif
+
+  switch( LCD_Code )
+  {
+     default:		 /* 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505 0x0505 0x7783 0x4531 0x4535 */
+          LCD_WriteReg(0x0050, Hstart );
+          LCD_WriteReg(0x0051, Hend );
+          LCD_WriteReg(0x0052, Vstart );
+          LCD_WriteReg(0x0053, Vend );
+	      break;
+
+     case SSD1298: 	 /* 0x8999 */
+     case SSD1289:   /* 0x8989 */
+          LCD_WriteReg(0x0044, ( Hend << 8 ) | Hstart );
+          LCD_WriteReg(0x0045, Vstart );
+          LCD_WriteReg(0x0046, Vend );
+	      break;
+
+     case HX8346A: 	 /* 0x0046 */
+     case HX8347A: 	 /* 0x0047 */
+     case HX8347D: 	 /* 0x0047 */
+	      LCD_WriteReg(0x02, Hstart>>8 );
+	      LCD_WriteReg(0x03, Hstart );
+	      LCD_WriteReg(0x04, Hend>>8 );
+	      LCD_WriteReg(0x05, Hend );
+	      LCD_WriteReg(0x06, Vstart>>8 );
+	      LCD_WriteReg(0x07, Vstart );
+	      LCD_WriteReg(0x08, Vend>>8 );
+	      LCD_WriteReg(0x09, Vend );
+	      break;
+
+     case SSD2119:	 /* 3.5 LCD 0x9919 */
+	      break;
+  }
+
+  LCD_SetCursor(Xstart,Ystart);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ResetWindow
+* Description    : Restores the full screen GRAM window
+* Input          : None
+* Output         : None
 * Return         : None
 * Attention		 : None
 *******************************************************************************/
-static void delay_ms(uint16_t ms)    
-{ 
-	uint16_t i,j; 
-	for( i = 0; i < ms; i++ )
-	{ 
-		for( j = 0; j < 1141; j++ );
-	}
-} 
+static void LCD_ResetWindow(void)
+{
+	LCD_SetWindow(0,0,MAX_X-1,MAX_Y-1);
+}
 
 
 /*******************************************************************************
@@ -301,6 +462,7 @@ void LCD_Initialization(void)
 {
 	uint16_t DeviceCode;
 	
+	delay_init();
 	LCD_Configuration();
 	delay_ms(100);
 	DeviceCode = LCD_ReadReg(0x0000);		/* ȡID	*/	
@@ -379,44 +541,339 @@ void LCD_Initialization(void)
     delay_ms(50);   /* delay 50 ms */	
 }
 
+/*******************************************************************************
+* Function Name  : LCD_SetScroll
+* Description    : Hardware vertical scroll: the panel shows GRAM starting
+*                  from gate line Line (0x6A) and wraps around, VLE in 0x61
+*                  turns it on. GRAM contents and coordinates do not change,
+*                  so drawing afterwards still uses GRAM rows.
+* Input          : - Line: first GRAM line shown at the top, 0 = no scroll
+* Output         : None
+* Return         : None
+* Attention		 : ILI9325/9328 only. Gate lines are screen rows for
+*                  DISP_ORIENTATION 0/180, screen columns for 90/270.
+*******************************************************************************/
+void LCD_SetScroll(uint16_t Line)
+{
+	if( LCD_Code != ILI9325 )
+	{
+		return;
+	}
+	Line %= 320;
+	LCD_WriteReg(0x006a,Line);
+	LCD_WriteReg(0x0061,Line ? 0x0003 : 0x0001);	/* REV = 1, VLE = 1 solo se serve */
+}
+
+/*******************************************************************************
+* Function Name  : LCD_PushClip
+* Description    : Restricts drawing to the rectangle, intersected with the
+*                  current clip: nested panels can only shrink it.
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+* Output         : None
+* Return         : None
+* Attention		 : Every push needs its LCD_PopClip. Only LCD_CLIP_DEPTH
+*                  levels are kept: deeper pushes leave the clip unchanged.
+*                  Pixel bursts (LCD_BeginPixels) are not clipped.
+*******************************************************************************/
+void LCD_PushClip(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height)
+{
+	LCD_Rect *r;
+	int32_t x1 = (int32_t)Xpos + Width - 1, y1 = (int32_t)Ypos + Height - 1;
+
+	if( LCD_ClipTop == LCD_CLIP_DEPTH )
+	{
+		LCD_ClipLost++;
+		return;
+	}
+	r = &LCD_ClipStack[LCD_ClipTop + 1];
+	r->x0 = ( Xpos > LCD_Clip.x0 ) ? Xpos : LCD_Clip.x0;
+	r->y0 = ( Ypos > LCD_Clip.y0 ) ? Ypos : LCD_Clip.y0;
+	r->x1 = ( x1 < LCD_Clip.x1 ) ? x1 : LCD_Clip.x1;	/* x1 < x0: vuoto */
+	r->y1 = ( y1 < LCD_Clip.y1 ) ? y1 : LCD_Clip.y1;
+	LCD_ClipTop++;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_PopClip
+* Description    : Restores the clip rectangle of the matching LCD_PushClip
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Does nothing with an empty stack (clip = screen)
+*******************************************************************************/
+void LCD_PopClip(void)
+{
+	if( LCD_ClipLost != 0 )
+	{
+		LCD_ClipLost--;
+	}
+	else if( LCD_ClipTop != 0 )
+	{
+		LCD_ClipTop--;
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_GetClip
+* Description    : Current clip rectangle, for modules that stream their own
+*                  windows (images)
+* Input          : None
+* Output         : None
+* Return         : Corners included; empty if x1 < x0 or y1 < y0
+* Attention		 : Valid until the next LCD_PushClip/LCD_PopClip
+*******************************************************************************/
+const LCD_Rect *LCD_GetClip(void)
+{
+	return &LCD_Clip;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ClipRect
+* Description    : Intersects the box (x0,y0)-(x1,y1) with the clip rectangle
+* Input          : - x0, y0, x1, y1: box, corners included, signed
+* Output         : - x0, y0, x1, y1: visible part
+* Return         : 0 if nothing is visible
+* Attention		 : None
+*******************************************************************************/
+static uint8_t LCD_ClipRect( int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1 )
+{
+	if( *x0 < LCD_Clip.x0 ) *x0 = LCD_Clip.x0;
+	if( *y0 < LCD_Clip.y0 ) *y0 = LCD_Clip.y0;
+	if( *x1 > LCD_Clip.x1 ) *x1 = LCD_Clip.x1;
+	if( *y1 > LCD_Clip.y1 ) *y1 = LCD_Clip.y1;
+	return *x0 <= *x1 && *y0 <= *y1;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FillBox
+* Description    : Fills (x0,y0)-(x1,y1) through one GRAM window: one 0x22
+*                  index, then w*h data writes with CS held low.
+* Input          : - x0, y0, x1, y1: box, corners included
+*                  - Color: fill color
+* Output         : None
+* Return         : None
+* Attention		 : Already clipped: no bounds tests here
+*******************************************************************************/
+static void LCD_FillBox( int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t Color )
+{
+	LCD_BeginPixels(x0,y0,x1-x0+1,y1-y0+1);
+	LCD_PushColor(Color,(uint32_t)(x1-x0+1)*(y1-y0+1));
+	LCD_EndPixels();
+}
+
 /*******************************************************************************
 * Function Name  : LCD_Clear
 * Description    : Ļָɫ 0xffff
 * Input          : - Color: Screen Color
 * Output         : None
 * Return         : None
-* Attention		 : None
+* Attention		 : Fills the clip rectangle (the whole screen by default)
 *******************************************************************************/
 void LCD_Clear(uint16_t Color)
 {
-	uint32_t index;
-	
-	if( LCD_Code == HX8347D || LCD_Code == HX8347A )
-	{
-		LCD_WriteReg(0x02,0x00);                                                  
-		LCD_WriteReg(0x03,0x00);  
-		                
-		LCD_WriteReg(0x04,0x00);                           
-		LCD_WriteReg(0x05,0xEF);  
-		                 
-		LCD_WriteReg(0x06,0x00);                           
-		LCD_WriteReg(0x07,0x00);    
-		               
-		LCD_WriteReg(0x08,0x01);                           
-		LCD_WriteReg(0x09,0x3F);     
+	LCD_FillRect(0,0,MAX_X,MAX_Y,Color);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FillRect
+* Description    : Fills a rectangle with one color using a single GRAM window
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+*                  - Color: fill color
+* Output         : None
+* Return         : None
+* Attention		 : The rectangle is clipped once, to the clip rectangle
+*******************************************************************************/
+void LCD_FillRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t Color)
+{
+	int32_t x0 = Xpos, y0 = Ypos, x1 = (int32_t)Xpos + Width - 1, y1 = (int32_t)Ypos + Height - 1;
+
+	if( LCD_ClipRect( &x0, &y0, &x1, &y1 ) )
+	{
+		LCD_FillBox( x0, y0, x1, y1, Color );
 	}
-	else
-	{	
-		LCD_SetCursor(0,0); 
-	}	
+}
+
+/*******************************************************************************
+* Function Name  : LCD_BeginPixels
+* Description    : Opens a pixel burst: GRAM window, 0x22 index, CS low and
+*                  RS high. The bus is set up once here, each pushed pixel
+*                  only latches its data (if it changed) and pulses WR.
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+* Output         : None
+* Return         : None
+* Attention		 : The rectangle must be on screen. Pixels fill it row by row
+*                  and wrap. No other LCD call and no other use of P2.0-7
+*                  (LEDs) until LCD_EndPixels: an ISR writing them spoils up
+*                  to LCD_RELATCH pixels (see GLCD.h).
+*******************************************************************************/
+void LCD_BeginPixels(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height)
+{
+	LCD_RelatchLeft = LCD_RELATCH;
+	LCD_SetWindow(Xpos,Ypos,Xpos+Width-1,Ypos+Height-1);
+	LCD_WriteIndex(0x0022);
+
+	LCD_CS(0);
+	LCD_RS(1);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_PushPixel
+* Description    : Writes the next pixel of the burst
+* Input          : - Color: RGB565 color
+* Output         : None
+* Return         : None
+* Attention		 : Only between LCD_BeginPixels and LCD_EndPixels
+*******************************************************************************/
+void LCD_PushPixel(uint16_t Color)
+{
+	LCD_WriteGRAM( Color );
+}
+
+/*******************************************************************************
+* Function Name  : LCD_PushPixels
+* Description    : Writes count pixels of the burst from a buffer
+* Input          : - Color: RGB565 colors
+*                  - count: number of pixels
+* Output         : None
+* Return         : None
+* Attention		 : Only between LCD_BeginPixels and LCD_EndPixels
+*******************************************************************************/
+void LCD_PushPixels(const uint16_t *Color,uint32_t count)
+{
+	while( count-- )
+	{
+		LCD_WriteGRAM( *Color++ );
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_PushColor
+* Description    : Writes count pixels of the same color: the word is latched
+*                  once, then only WR is pulsed (the high byte is driven
+*                  again every LCD_RELATCH pixels, see LCD_Relatch).
+* Input          : - Color: RGB565 color
+*                  - count: number of pixels
+* Output         : None
+* Return         : None
+* Attention		 : Only between LCD_BeginPixels and LCD_EndPixels
+*******************************************************************************/
+void LCD_PushColor(uint16_t Color,uint32_t count)
+{
+	uint32_t n;
+
+	if( count == 0 )
+	{
+		return;
+	}
+	LCD_Send( Color );
+	while( count != 0 )
+	{
+		n = ( count < LCD_RelatchLeft ) ? count : LCD_RelatchLeft;
+		count -= n;
+		LCD_RelatchLeft -= n;
+		while( n-- )
+		{
+			LCD_PulseWR();
+		}
+		if( LCD_RelatchLeft == 0 )
+		{
+			LCD_Relatch();
+		}
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_EndPixels
+* Description    : Closes the burst and restores the full screen window
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_EndPixels(void)
+{
+	LCD_Deselect();
+	LCD_ResetWindow();
+}
+
+/*******************************************************************************
+* Function Name  : LCD_BeginRead
+* Description    : Opens a GRAM read burst: window, 0x22 index, CS low, the
+*                  bus turned around once and the dummy read done. Each
+*                  following read returns the next pixel of the window
+*                  (auto-increment, row by row).
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+* Output         : None
+* Return         : None
+* Attention		 : The rectangle must be on screen. Close with LCD_EndPixels.
+*                  ILI9325/9328 only (see LCD_GetPoint for the others).
+*******************************************************************************/
+void LCD_BeginRead(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height)
+{
+	uint16_t dummy;
 
+	LCD_SetWindow(Xpos,Ypos,Xpos+Width-1,Ypos+Height-1);
 	LCD_WriteIndex(0x0022);
-	for( index = 0; index < MAX_X * MAX_Y; index++ )
+
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_WR(1);
+	LCD_BusValid = 0;
+	LPC_GPIO2->FIODIR &= ~(0xFF);              /* P2.0...P2.7 Input */
+	LCD_DIR(0);		   				           				 /* Interface B->A */
+	LCD_EN(0);
+	LCD_ReadPixels(&dummy,1);                  /* Empty read */
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ReadPixels
+* Description    : Reads count pixels of the burst. Only RD and EN toggle per
+*                  pixel. Red and blue come back swapped (BGR = 1 in 0x03)
+*                  and are put back in RGB565 order, as LCD_BGR2RGB does.
+* Input          : - count: number of pixels
+* Output         : - Color: RGB565 colors
+* Return         : None
+* Attention		 : Only between LCD_BeginRead and LCD_EndPixels
+*******************************************************************************/
+void LCD_ReadPixels(uint16_t *Color,uint32_t count)
+{
+	uint16_t value;
+
+	while( count-- )
 	{
-		LCD_WriteData(Color);
+		LCD_RD(0);
+		DELAY_NS(LCD_T_RATFM);
+		value = LPC_GPIO2->FIOPIN0;              /* Read D8..D15 */
+		LCD_EN(1);	                             /* Enable 1B->1A */
+		DELAY_NS(LCD_T_RDD);
+		value = (value << 8) | LPC_GPIO2->FIOPIN0; /* Read D0..D7 */
+		LCD_EN(0);	                             /* Enable 2B->2A */
+		LCD_RD(1);
+		DELAY_NS(LCD_T_RDHFM);
+		*Color++ = (uint16_t)( ((value & 0x1f) << 11) | (value & 0x07e0) | (value >> 11) );
 	}
 }
 
+/*******************************************************************************
+* Function Name  : LCD_ReadRect
+* Description    : Reads a rectangle of GRAM in one burst, row by row
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+* Output         : - Color: Width*Height RGB565 colors
+* Return         : None
+* Attention		 : The rectangle must be on screen
+*******************************************************************************/
+void LCD_ReadRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t *Color)
+{
+	LCD_BeginRead(Xpos,Ypos,Width,Height);
+	LCD_ReadPixels(Color,(uint32_t)Width * Height);
+	LCD_EndPixels();
+}
+
 /******************************************************************************
 * Function Name  : LCD_BGR2RGB
 * Description    : RRRRRGGGGGGBBBBB Ϊ BBBBBGGGGGGRRRRR ʽ
@@ -496,7 +953,7 @@ uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos)
 *******************************************************************************/
 void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point)
 {
-	if( Xpos >= MAX_X || Ypos >= MAX_Y )
+	if( Xpos < LCD_Clip.x0 || Xpos > LCD_Clip.x1 || Ypos < LCD_Clip.y0 || Ypos > LCD_Clip.y1 )
 	{
 		return;
 	}
@@ -508,102 +965,819 @@ void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point)
 
 
 /******************************************************************************
-* Function Name  : LCD_DrawLine
-* Description    : Bresenham's line algorithm
-* Input          : - x1: A
-*                  - y1: A 
-*				   - x2: B
-*				   - y2: B 
-*				   - color: ɫ
+* Function Name  : LCD_HSpan
+* Description    : Draws len pixels to the right of (Xpos,Ypos). With the
+*                  full screen window the GRAM address increments along the
+*                  row, so only the cursor is set: no window setup.
+* Input          : - Xpos, Ypos: first pixel
+*                  - len: number of pixels
+*                  - color: line color
 * Output         : None
 * Return         : None
-* Attention		 : None
-*******************************************************************************/	 
-void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color ) //linea da x0 a y0 a x1 y1
+* Attention		 : Already clipped, len > 0: no bounds tests here
+*******************************************************************************/
+static void LCD_HSpan( uint16_t Xpos, uint16_t Ypos, uint16_t len, uint16_t color )
 {
-    short dx,dy;      /* X Yӵıֵ */
-    short temp;       /*  յСȽ ʱм */
+    #if  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
 
-    if( x0 > x1 )     /* Xյ  */
-    {
-	    temp = x1;
-		x1 = x0;
-		x0 = temp;   
-    }
-    if( y0 > y1 )     /* Yյ  */
-    {
-		temp = y1;
-		y1 = y0;
-		y0 = temp;   
-    }
-  
-	dx = x1-x0;       /* X᷽ϵ */
-	dy = y1-y0;       /* Y᷽ϵ */
+	LCD_SetCursor(Xpos,Ypos);
+	LCD_WriteIndex(0x0022);
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_PushColor(color,len);
+	LCD_Deselect();
 
-    if( dx == 0 )     /* Xû ֱ */ 
-    {
-        do
-        { 
-            LCD_SetPoint(x0, y0, color);   /* ʾ 费ֱ */
-            y0++;
-        }
-        while( y1 >= y0 ); 
-		return; 
-    }
-    if( dy == 0 )     /* Yû ˮƽֱ */ 
-    {
-        do
-        {
-            LCD_SetPoint(x0, y0, color);   /* ʾ ˮƽ */
-            x0++;
-        }
-        while( x1 >= x0 ); 
-		return;
-    }
-	/* ɭķ(Bresenham)㷨 */
-    if( dx > dy )                         /* X */
-    {
-	    temp = 2 * dy - dx;               /* ¸λ */         
-        while( x0 != x1 )
-        {
-	        LCD_SetPoint(x0,y0,color);    /*  */ 
-	        x0++;                         /* Xϼ1 */
-	        if( temp > 0 )                /* ж¸λ */
-	        {
-	            y0++;                     /* Ϊڵ㣬x0+1,y0+1 */ 
-	            temp += 2 * dy - 2 * dx; 
-	 	    }
-            else         
-            {
-			    temp += 2 * dy;           /* ж¸λ */  
-			}       
-        }
-        LCD_SetPoint(x0,y0,color);
-    }  
-    else
-    {
-	    temp = 2 * dx - dy;                      /* Y */       
-        while( y0 != y1 )
-        {
-	 	    LCD_SetPoint(x0,y0,color);     
-            y0++;                 
-            if( temp > 0 )           
-            {
-                x0++;               
-                temp+=2*dy-2*dx; 
-            }
-            else
-			{
-                temp += 2 * dy;
-			}
-        } 
-        LCD_SetPoint(x0,y0,color);
-	}
-} 
+	#else
 
+	LCD_FillBox(Xpos,Ypos,Xpos+len-1,Ypos,color);	/* GRAM rows are screen columns */
+
+	#endif
+}
 
 /******************************************************************************
-* Function Name  : PutChar
+* Function Name  : LCD_VSpan
+* Description    : Draws len pixels below (Xpos,Ypos) through a 1 pixel wide
+*                  window. Window setup costs about as much as 4 single
+*                  pixels, so shorter spans are written pixel by pixel.
+* Input          : - Xpos, Ypos: first pixel
+*                  - len: number of pixels
+*                  - color: line color
+* Output         : None
+* Return         : None
+* Attention		 : Already clipped, len > 0
+*******************************************************************************/
+static void LCD_VSpan( uint16_t Xpos, uint16_t Ypos, uint16_t len, uint16_t color )
+{
+	if( len >= 5 )
+	{
+		LCD_FillBox(Xpos,Ypos,Xpos,Ypos+len-1,color);
+		return;
+	}
+	while( len-- )
+	{
+		LCD_HSpan(Xpos,Ypos++,1,color);
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_ClipSpan
+* Description    : Horizontal span from x0 to x1 (inclusive) on row y, with
+*                  signed coordinates: shapes may extend off screen. Clipped
+*                  to the clip rectangle, then streamed.
+* Input          : - x0, x1: first and last column
+*                  - y: row
+*                  - color: span color
+* Output         : None
+* Return         : None
+* Attention		 : Nothing is drawn if x1 < x0
+*******************************************************************************/
+static void LCD_ClipSpan( int32_t x0, int32_t x1, int32_t y, uint16_t color )
+{
+	if( y < LCD_Clip.y0 || y > LCD_Clip.y1 )
+	{
+		return;
+	}
+	if( x0 < LCD_Clip.x0 )
+	{
+		x0 = LCD_Clip.x0;
+	}
+	if( x1 > LCD_Clip.x1 )
+	{
+		x1 = LCD_Clip.x1;
+	}
+	if( x0 <= x1 )
+	{
+		LCD_HSpan( x0, y, x1 - x0 + 1, color );
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_ClipBox
+* Description    : Filled box from (x0,y0) to (x1,y1) inclusive, signed
+*                  coordinates. One pixel wide boxes go through LCD_VSpan.
+* Input          : - x0, y0: top-left corner
+*                  - x1, y1: bottom-right corner
+*                  - color: fill color
+* Output         : None
+* Return         : None
+* Attention		 : Nothing is drawn if the box is empty
+*******************************************************************************/
+static void LCD_ClipBox( int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color )
+{
+	if( !LCD_ClipRect( &x0, &y0, &x1, &y1 ) )
+	{
+		return;
+	}
+	if( x0 == x1 )
+	{
+		LCD_VSpan( x0, y0, y1 - y0 + 1, color );
+	}
+	else if( y0 == y1 )
+	{
+		LCD_HSpan( x0, y0, x1 - x0 + 1, color );
+	}
+	else
+	{
+		LCD_FillBox( x0, y0, x1, y1, color );
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_AxisSteps
+* Description    : Steps i for which p + s*i lies in [c0, c1]
+* Input          : - p: start coordinate
+*                  - s: direction, +1 or -1
+*                  - c0, c1: clip interval
+* Output         : - lo, hi: step interval (may be empty or negative)
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_AxisSteps( int32_t p, int32_t s, int32_t c0, int32_t c1, int32_t *lo, int32_t *hi )
+{
+	*lo = ( s > 0 ) ? c0 - p : p - c1;
+	*hi = ( s > 0 ) ? c1 - p : p - c0;
+}
+
+/******************************************************************************
+* Function Name  : LCD_LineClip
+* Description    : Visible steps of a Bresenham line. With n steps on the
+*                  major axis and d on the minor one (0 < d <= n), at step i
+*                  the minor axis has moved k(i) = (2*d*i + n - 1) / (2*n)
+*                  times (integer division, the same rounding as the loop of
+*                  LCD_DrawLine). k(i) grows with i, so the steps where
+*                  k is in [klo, khi] are an interval found in closed form.
+* Input          : - n, d: major and minor deltas
+*                  - ilo, ihi: steps inside the clip on the major axis
+*                  - klo, khi: minor moves inside the clip on the minor axis
+* Output         : - first, last: visible steps
+* Return         : 0 if the line is outside the clip
+* Attention		 : None
+*******************************************************************************/
+static uint8_t LCD_LineClip( int32_t n, int32_t d, int32_t ilo, int32_t ihi, int32_t klo, int32_t khi, int32_t *first, int32_t *last )
+{
+	int64_t n2 = 2 * (int64_t)n, d2 = 2 * (int64_t)d, t;
+
+	if( ilo < 0 )
+	{
+		ilo = 0;
+	}
+	if( ihi > n )
+	{
+		ihi = n;
+	}
+	if( khi < 0 )
+	{
+		return 0;
+	}
+	if( klo > 0 )	/* primo i con k(i) >= klo */
+	{
+		t = ( n2 * klo - n + 1 + d2 - 1 ) / d2;
+		if( t > ilo ) ilo = t;
+	}
+	t = ( n2 * khi + n + 1 + d2 - 1 ) / d2 - 1;		/* ultimo i con k(i) <= khi */
+	if( t < ihi ) ihi = t;
+
+	*first = ilo;
+	*last  = ihi;
+	return ilo <= ihi;
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawLine
+* Description    : Bresenham's line algorithm, all octants. Pixels on the same
+*                  row (or column, for steep lines) are grouped into one span,
+*                  horizontal and vertical lines are a single span.
+*                  The line is clipped once, before the loop: the Bresenham
+*                  state jumps to the first visible step and the loop stops
+*                  at the last one, so the spans need no bounds tests.
+* Input          : - x0, y0: first end point
+*                  - x1, y1: second end point
+*                  - color: line color
+* Output         : None
+* Return         : None
+* Attention		 : Both end points are drawn. The clipped line has exactly the
+*                  pixels of the whole line that are inside the clip.
+*******************************************************************************/
+void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color ) //linea da x0 a y0 a x1 y1
+{
+	int32_t dx, dy, sx, sy, err;
+	int32_t x, y, start, end, ilo, ihi, klo, khi, first, last, k;
+
+	dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+	dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+	sx = (x1 >= x0) ? 1 : -1;
+	sy = (y1 >= y0) ? 1 : -1;
+
+	if( dy == 0 )		/* orizzontale */
+	{
+		LCD_ClipSpan( (x0 < x1) ? x0 : x1, (x0 < x1) ? x1 : x0, y0, color );
+		return;
+	}
+	if( dx == 0 )		/* verticale */
+	{
+		LCD_ClipBox( x0, (y0 < y1) ? y0 : y1, x0, (y0 < y1) ? y1 : y0, color );
+		return;
+	}
+
+	LCD_AxisSteps( x0, sx, LCD_Clip.x0, LCD_Clip.x1, (dx >= dy) ? &ilo : &klo, (dx >= dy) ? &ihi : &khi );
+	LCD_AxisSteps( y0, sy, LCD_Clip.y0, LCD_Clip.y1, (dx >= dy) ? &klo : &ilo, (dx >= dy) ? &khi : &ihi );
+
+	if( dx >= dy )		/* asse X principale: tratti orizzontali */
+	{
+		if( !LCD_LineClip( dx, dy, ilo, ihi, klo, khi, &first, &last ) )
+		{
+			return;
+		}
+		k = (int32_t)( ( 2 * (int64_t)dy * first + dx - 1 ) / ( 2 * (int64_t)dx ) );
+		x = x0 + sx * first;
+		y = y0 + sy * k;
+		end = x0 + sx * last;
+		err = 2 * dy * (first + 1) - dx - 2 * dx * k;
+		start = x;
+		for( ;; )
+		{
+			if( x == end || err > 0 )	/* il prossimo punto cambia riga: chiude il tratto */
+			{
+				LCD_HSpan( (sx > 0) ? start : x, y, ((x > start) ? x - start : start - x) + 1, color );
+				if( x == end )
+				{
+					break;
+				}
+				y += sy;
+				err -= 2 * dx;
+				start = x + sx;
+			}
+			x += sx;
+			err += 2 * dy;
+		}
+	}
+	else				/* asse Y principale: tratti verticali */
+	{
+		if( !LCD_LineClip( dy, dx, ilo, ihi, klo, khi, &first, &last ) )
+		{
+			return;
+		}
+		k = (int32_t)( ( 2 * (int64_t)dx * first + dy - 1 ) / ( 2 * (int64_t)dy ) );
+		y = y0 + sy * first;
+		x = x0 + sx * k;
+		end = y0 + sy * last;
+		err = 2 * dx * (first + 1) - dy - 2 * dy * k;
+		start = y;
+		for( ;; )
+		{
+			if( y == end || err > 0 )
+			{
+				LCD_VSpan( x, (sy > 0) ? start : y, ((y > start) ? y - start : start - y) + 1, color );
+				if( y == end )
+				{
+					break;
+				}
+				x += sx;
+				err -= 2 * dy;
+				start = y + sy;
+			}
+			y += sy;
+			err += 2 * dx;
+		}
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawRect
+* Description    : Rectangle outline: two horizontal and two vertical spans
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+*                  - Color: outline color
+* Output         : None
+* Return         : None
+* Attention		 : Clipped to the screen
+*******************************************************************************/
+void LCD_DrawRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t Color)
+{
+	int32_t x1 = (int32_t)Xpos + Width - 1, y1 = (int32_t)Ypos + Height - 1;
+
+	if( Width == 0 || Height == 0 )
+	{
+		return;
+	}
+	LCD_ClipSpan( Xpos, x1, Ypos, Color );
+	if( Height > 1 )
+	{
+		LCD_ClipSpan( Xpos, x1, y1, Color );
+	}
+	LCD_ClipBox( Xpos, Ypos + 1, Xpos, y1 - 1, Color );
+	if( Width > 1 )
+	{
+		LCD_ClipBox( x1, Ypos + 1, x1, y1 - 1, Color );
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_RoundShape
+* Description    : Rasterizes the box (xl,yt)-(xr,yb) grown by an ellipse of
+*                  radii a, b: an ellipse or circle when the box is a point,
+*                  a rounded rectangle when the box joins the corner centers.
+*                  The half width of each row comes from the midpoint
+*                  decision variable d = b^2*x^2 + a^2*j^2 - a^2*b^2 - E,
+*                  updated with additions only. E = a*b*(a+b)/2 keeps the
+*                  pixels whose center is within about half a pixel of the
+*                  curve (x^2 + y^2 <= r^2 + r for a circle).
+*                  Filled: one span per row. Outline: each row draws from
+*                  its half width down to one past the next row's, so
+*                  consecutive rows touch at least diagonally; the last row
+*                  is the whole top (bottom) edge.
+* Input          : - xl, yt, xr, yb: box
+*                  - a, b: horizontal and vertical radius
+*                  - fill: 1 filled, 0 outline
+*                  - color: shape color
+* Output         : None
+* Return         : None
+* Attention		 : xl <= xr, yt <= yb. Clipped to the screen
+*******************************************************************************/
+static void LCD_RoundShape( int32_t xl, int32_t yt, int32_t xr, int32_t yb, int32_t a, int32_t b, uint8_t fill, uint16_t color )
+{
+	int64_t a2 = (int64_t)a * a, b2 = (int64_t)b * b, d;
+	int32_t j, x = a, w = a, wn, in;
+
+	/* fascia centrale, righe comprese fra yt e yb esclusi */
+	if( fill )
+	{
+		LCD_ClipBox( xl - a, yt + 1, xr + a, yb - 1, color );
+	}
+	else
+	{
+		LCD_ClipBox( xl - a, yt + 1, xl - a, yb - 1, color );
+		LCD_ClipBox( xr + a, yt + 1, xr + a, yb - 1, color );
+	}
+
+	d = -( (int64_t)a * b * (a + b) / 2 );
+	for( j = 0; j <= b; j++ )
+	{
+		/* semiampiezza della riga successiva (-1 oltre l'ultima) */
+		if( j < b )
+		{
+			d += a2 * (2 * j + 1);
+			while( x > 0 && d > 0 )
+			{
+				d -= b2 * (2 * x - 1);
+				x--;
+			}
+			wn = x;
+		}
+		else
+		{
+			wn = -1;
+		}
+
+		in = (wn + 1 < w) ? wn + 1 : w;
+		if( fill || wn < 0 || (xr + in) - (xl - in) <= 1 )	/* pieno, ultima riga o tratti uniti */
+		{
+			LCD_ClipSpan( xl - w, xr + w, yt - j, color );
+			if( yb + j != yt - j )
+			{
+				LCD_ClipSpan( xl - w, xr + w, yb + j, color );
+			}
+		}
+		else
+		{
+			LCD_ClipSpan( xl - w, xl - in, yt - j, color );
+			LCD_ClipSpan( xr + in, xr + w, yt - j, color );
+			if( yb + j != yt - j )
+			{
+				LCD_ClipSpan( xl - w, xl - in, yb + j, color );
+				LCD_ClipSpan( xr + in, xr + w, yb + j, color );
+			}
+		}
+		w = wn;
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_RoundRect
+* Description    : Rounded rectangle with the radius clamped to fit the box
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+*                  - Radius: corner radius
+*                  - fill: 1 filled, 0 outline
+*                  - Color: shape color
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_RoundRect( uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius, uint8_t fill, uint16_t Color )
+{
+	uint16_t max;
+
+	if( Width == 0 || Height == 0 )
+	{
+		return;
+	}
+	max = ((Width < Height) ? Width - 1 : Height - 1) / 2;
+	if( Radius > max )
+	{
+		Radius = max;
+	}
+	LCD_RoundShape( (int32_t)Xpos + Radius, (int32_t)Ypos + Radius,
+	                (int32_t)Xpos + Width - 1 - Radius, (int32_t)Ypos + Height - 1 - Radius,
+	                Radius, Radius, fill, Color );
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawRoundRect
+* Description    : Rounded rectangle outline
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+*                  - Radius: corner radius
+*                  - Color: outline color
+* Output         : None
+* Return         : None
+* Attention		 : Radius is reduced if it does not fit
+*******************************************************************************/
+void LCD_DrawRoundRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t Radius,uint16_t Color)
+{
+	LCD_RoundRect( Xpos, Ypos, Width, Height, Radius, 0, Color );
+}
+
+/******************************************************************************
+* Function Name  : LCD_FillRoundRect
+* Description    : Filled rounded rectangle: one window for the middle band,
+*                  one span per row of the corners
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+*                  - Radius: corner radius
+*                  - Color: fill color
+* Output         : None
+* Return         : None
+* Attention		 : Radius is reduced if it does not fit
+*******************************************************************************/
+void LCD_FillRoundRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t Radius,uint16_t Color)
+{
+	LCD_RoundRect( Xpos, Ypos, Width, Height, Radius, 1, Color );
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawCircle
+* Description    : Circle outline (midpoint algorithm)
+* Input          : - Xpos, Ypos: center
+*                  - Radius: radius in pixels
+*                  - Color: outline color
+* Output         : None
+* Return         : None
+* Attention		 : Clipped to the screen
+*******************************************************************************/
+void LCD_DrawCircle(uint16_t Xpos,uint16_t Ypos,uint16_t Radius,uint16_t Color)
+{
+	LCD_RoundShape( Xpos, Ypos, Xpos, Ypos, Radius, Radius, 0, Color );
+}
+
+/******************************************************************************
+* Function Name  : LCD_FillCircle
+* Description    : Filled circle, one span per row
+* Input          : - Xpos, Ypos: center
+*                  - Radius: radius in pixels
+*                  - Color: fill color
+* Output         : None
+* Return         : None
+* Attention		 : Clipped to the screen
+*******************************************************************************/
+void LCD_FillCircle(uint16_t Xpos,uint16_t Ypos,uint16_t Radius,uint16_t Color)
+{
+	LCD_RoundShape( Xpos, Ypos, Xpos, Ypos, Radius, Radius, 1, Color );
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawEllipse
+* Description    : Axis-aligned ellipse outline (midpoint algorithm)
+* Input          : - Xpos, Ypos: center
+*                  - Xradius, Yradius: horizontal and vertical radius
+*                  - Color: outline color
+* Output         : None
+* Return         : None
+* Attention		 : Clipped to the screen
+*******************************************************************************/
+void LCD_DrawEllipse(uint16_t Xpos,uint16_t Ypos,uint16_t Xradius,uint16_t Yradius,uint16_t Color)
+{
+	LCD_RoundShape( Xpos, Ypos, Xpos, Ypos, Xradius, Yradius, 0, Color );
+}
+
+/******************************************************************************
+* Function Name  : LCD_FillEllipse
+* Description    : Filled axis-aligned ellipse, one span per row
+* Input          : - Xpos, Ypos: center
+*                  - Xradius, Yradius: horizontal and vertical radius
+*                  - Color: fill color
+* Output         : None
+* Return         : None
+* Attention		 : Clipped to the screen
+*******************************************************************************/
+void LCD_FillEllipse(uint16_t Xpos,uint16_t Ypos,uint16_t Xradius,uint16_t Yradius,uint16_t Color)
+{
+	LCD_RoundShape( Xpos, Ypos, Xpos, Ypos, Xradius, Yradius, 1, Color );
+}
+
+/* Lato di un poligono percorso dall'alto verso il basso, una riga per volta,
+ * con gli stessi passi di LCD_DrawLine: i pixel del bordo di un poligono
+ * pieno coincidono con quelli del suo contorno. */
+typedef struct {
+	int16_t x, x1;		/* colonna corrente e finale */
+	int16_t dx, dy;		/* |x1 - x0|, y1 - y0 */
+	int16_t sx;			/* verso lungo x */
+	int16_t err;
+} LCD_Edge;
+
+/******************************************************************************
+* Function Name  : LCD_EdgeInit
+* Description    : Prepares the walk of the edge (x0,y0)-(x1,y1)
+* Input          : - e: edge
+*                  - x0, y0: top end point
+*                  - x1, y1: bottom end point
+* Output         : None
+* Return         : None
+* Attention		 : y0 <= y1
+*******************************************************************************/
+static void LCD_EdgeInit( LCD_Edge *e, int16_t x0, int16_t y0, int16_t x1, int16_t y1 )
+{
+	e->x  = x0;
+	e->x1 = x1;
+	e->dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+	e->dy = y1 - y0;
+	e->sx = (x1 >= x0) ? 1 : -1;
+	e->err = (e->dx >= e->dy) ? 2 * e->dy - e->dx : 2 * e->dx - e->dy;
+}
+
+/******************************************************************************
+* Function Name  : LCD_EdgeRow
+* Description    : Returns the pixels of the edge on the current row and
+*                  moves to the next row
+* Input          : - e: edge
+* Output         : - lo, hi: first and last column of the run
+* Return         : None
+* Attention		 : Call once per row, from y0 to y1
+*******************************************************************************/
+static void LCD_EdgeRow( LCD_Edge *e, int16_t *lo, int16_t *hi )
+{
+	int16_t start = e->x;
+
+	if( e->dx >= e->dy )	/* asse X principale: un tratto per riga */
+	{
+		while( e->x != e->x1 && e->err <= 0 )
+		{
+			e->x += e->sx;
+			e->err += 2 * e->dy;
+		}
+		*lo = (start < e->x) ? start : e->x;
+		*hi = (start < e->x) ? e->x : start;
+		if( e->x != e->x1 )
+		{
+			e->err -= 2 * e->dx;
+			e->x += e->sx;
+			e->err += 2 * e->dy;
+		}
+	}
+	else					/* asse Y principale: un pixel per riga */
+	{
+		*lo = *hi = start;
+		if( e->err > 0 )
+		{
+			e->x += e->sx;
+			e->err -= 2 * e->dy;
+		}
+		e->err += 2 * e->dx;
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawTriangle
+* Description    : Triangle outline
+* Input          : - x0, y0, x1, y1, x2, y2: vertices
+*                  - color: outline color
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_DrawTriangle( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color )
+{
+	LCD_Point pt[3];
+
+	pt[0].x = x0; pt[0].y = y0;
+	pt[1].x = x1; pt[1].y = y1;
+	pt[2].x = x2; pt[2].y = y2;
+	LCD_DrawPolygon( pt, 3, color );
+}
+
+/******************************************************************************
+* Function Name  : LCD_FillTriangle
+* Description    : Filled triangle: the long edge and the two short ones are
+*                  walked together, each row is one span from the leftmost
+*                  to the rightmost edge pixel.
+* Input          : - x0, y0, x1, y1, x2, y2: vertices
+*                  - color: fill color
+* Output         : None
+* Return         : None
+* Attention		 : Covers the same pixels as LCD_DrawTriangle plus the inside
+*******************************************************************************/
+void LCD_FillTriangle( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color )
+{
+	LCD_Edge e02, e01, e12;
+	int16_t y, lo, hi, l, h, t;
+
+	/* vertici ordinati per y */
+	if( y0 > y1 ) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+	if( y1 > y2 ) { t = x1; x1 = x2; x2 = t; t = y1; y1 = y2; y2 = t; }
+	if( y0 > y1 ) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+
+	LCD_EdgeInit( &e02, x0, y0, x2, y2 );
+	LCD_EdgeInit( &e01, x0, y0, x1, y1 );
+	LCD_EdgeInit( &e12, x1, y1, x2, y2 );
+
+	for( y = y0; y <= y2; y++ )
+	{
+		LCD_EdgeRow( &e02, &lo, &hi );
+		if( y <= y1 )
+		{
+			LCD_EdgeRow( &e01, &l, &h );
+			if( l < lo ) lo = l;
+			if( h > hi ) hi = h;
+		}
+		if( y >= y1 )
+		{
+			LCD_EdgeRow( &e12, &l, &h );
+			if( l < lo ) lo = l;
+			if( h > hi ) hi = h;
+		}
+		LCD_ClipSpan( lo, hi, y, color );
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_DrawPolygon
+* Description    : Closed polygon outline. Each edge is drawn from its top
+*                  end point, as LCD_FillPolygon walks it.
+* Input          : - pt: vertices
+*                  - count: number of vertices
+*                  - color: outline color
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_DrawPolygon( const LCD_Point *pt, uint8_t count, uint16_t color )
+{
+	uint8_t i;
+	const LCD_Point *a, *b;
+
+	for( i = 0; i < count; i++ )
+	{
+		a = &pt[i];
+		b = &pt[(i + 1 == count) ? 0 : i + 1];
+		if( a->y <= b->y )
+		{
+			LCD_DrawLine( a->x, a->y, b->x, b->y, color );
+		}
+		else
+		{
+			LCD_DrawLine( b->x, b->y, a->x, a->y, color );
+		}
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_FillPolygon
+* Description    : Filled polygon, even-odd rule, also concave. On each row
+*                  every edge gives its run of pixels: edges that continue
+*                  below the row are crossings and are filled in pairs, the
+*                  last row of an edge (and horizontal edges) is drawn as is.
+*                  This way a vertex is counted once and the border matches
+*                  LCD_DrawPolygon.
+* Input          : - pt: vertices
+*                  - count: number of vertices, at most LCD_POLY_MAX
+*                  - color: fill color
+* Output         : None
+* Return         : None
+* Attention		 : More than LCD_POLY_MAX vertices: nothing is drawn (cutting
+*                  the list would fill a different polygon)
+*******************************************************************************/
+void LCD_FillPolygon( const LCD_Point *pt, uint8_t count, uint16_t color )
+{
+	LCD_Edge edge[LCD_POLY_MAX];
+	int16_t ytop[LCD_POLY_MAX], ybot[LCD_POLY_MAX];
+	int16_t xlo[LCD_POLY_MAX], xhi[LCD_POLY_MAX];
+	int16_t y, ymin, ymax, lo, hi;
+	uint8_t i, k, n;
+	const LCD_Point *a, *b;
+
+	if( count == 0 || count > LCD_POLY_MAX )
+	{
+		return;
+	}
+
+	ymin = ymax = pt[0].y;
+	for( i = 0; i < count; i++ )
+	{
+		a = &pt[i];
+		b = &pt[(i + 1 == count) ? 0 : i + 1];
+		if( a->y > b->y )
+		{
+			a = b;
+			b = &pt[i];
+		}
+		LCD_EdgeInit( &edge[i], a->x, a->y, b->x, b->y );
+		ytop[i] = a->y;
+		ybot[i] = b->y;
+		if( a->y < ymin ) ymin = a->y;
+		if( b->y > ymax ) ymax = b->y;
+	}
+
+	for( y = ymin; y <= ymax && y <= LCD_Clip.y1; y++ )
+	{
+		n = 0;
+		for( i = 0; i < count; i++ )
+		{
+			if( y < ytop[i] || y > ybot[i] )
+			{
+				continue;
+			}
+			LCD_EdgeRow( &edge[i], &lo, &hi );
+			if( y == ybot[i] )		/* ultima riga del lato: solo bordo */
+			{
+				LCD_ClipSpan( lo, hi, y, color );
+				continue;
+			}
+			/* attraversamento: inserimento ordinato per colonna */
+			for( k = n; k > 0 && xlo[k - 1] > lo; k-- )
+			{
+				xlo[k] = xlo[k - 1];
+				xhi[k] = xhi[k - 1];
+			}
+			xlo[k] = lo;
+			xhi[k] = hi;
+			n++;
+		}
+		for( k = 0; k + 1 < n; k += 2 )
+		{
+			LCD_ClipSpan( xlo[k], (xhi[k + 1] > xhi[k]) ? xhi[k + 1] : xhi[k], y, color );
+		}
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_BlitText
+* Description    : Draws a run of 8x16 glyphs on one line through a single
+*                  GRAM window, streaming bitmap rows left to right. The run
+*                  is clipped once: the window is the visible part, and each
+*                  row streams the glyphs from the first to the last visible
+*                  column (partial glyphs only at the two ends).
+* Input          : - Xpos, Ypos: top-left corner of the first glyph
+*                  - glyph: bitmap rows of each glyph (see GetASCIIGlyph)
+*                  - count: number of glyphs
+*                  - charColor, bkColor: foreground and background colors
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_BlitText( uint16_t Xpos, uint16_t Ypos, const uint8_t **glyph, uint16_t count, uint16_t charColor, uint16_t bkColor )
+{
+	int32_t x0 = Xpos, y0 = Ypos, x1 = (int32_t)Xpos + 8 * count - 1, y1 = (int32_t)Ypos + 15;
+	uint16_t i, j, k, klast;
+	uint8_t bits, mask, mfirst, mlast, mstop;
+
+	if( count == 0 || !LCD_ClipRect( &x0, &y0, &x1, &y1 ) )
+	{
+		return;
+	}
+	/* colonne visibili: glifi k..klast, dal bit mfirst del primo al bit mlast dell'ultimo */
+	k      = ( x0 - Xpos ) >> 3;
+	klast  = ( x1 - Xpos ) >> 3;
+	mfirst = 0x80 >> ( ( x0 - Xpos ) & 7 );
+	mlast  = 0x80 >> ( ( x1 - Xpos ) & 7 );
+
+	LCD_BeginPixels(x0,y0,x1-x0+1,y1-y0+1);
+	for( i = y0 - Ypos; i <= y1 - Ypos; i++ )
+	{
+		mask = mfirst;
+		for( j = k; ; j++ )
+		{
+			bits  = glyph[j][i];
+			mstop = ( j == klast ) ? mlast : 0x01;
+			for( ;; mask >>= 1 )
+			{
+				LCD_WriteGRAM( (bits & mask) ? charColor : bkColor );
+				if( mask == mstop )
+				{
+					break;
+				}
+			}
+			if( j == klast )
+			{
+				break;
+			}
+			mask = 0x80;
+		}
+	}
+	LCD_EndPixels();
+}
+
+/******************************************************************************
+* Function Name  : PutChar
 * Description    : Lcdλʾһַ
 * Input          : - Xpos: ˮƽ 
 *                  - Ypos: ֱ  
@@ -616,24 +1790,9 @@ void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t
 *******************************************************************************/
 void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor )
 {
-	uint16_t i, j;
-    uint8_t buffer[16], tmp_char;
-    GetASCIICode(buffer,ASCI);  /* ȡģ */
-    for( i=0; i<16; i++ )
-    {
-        tmp_char = buffer[i];
-        for( j=0; j<8; j++ )
-        {
-            if( ((tmp_char >> (7 - j)) & 0x01) == 0x01 )
-            {
-                LCD_SetPoint( Xpos + j, Ypos + i, charColor );  /* ַɫ */
-            }
-            else
-            {
-                LCD_SetPoint( Xpos + j, Ypos + i, bkColor );  /* ɫ */
-            }
-        }
-    }
+	const uint8_t *glyph = GetASCIIGlyph(ASCI);
+
+	LCD_BlitText( Xpos, Ypos, &glyph, 1, charColor, bkColor );
 }
 
 /******************************************************************************
@@ -650,11 +1809,30 @@ void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, ui
 *******************************************************************************/
 void GUI_Text(uint16_t Xpos, uint16_t Ypos, uint8_t *str,uint16_t Color, uint16_t bkColor) //Xpos e Ypos rappresentano la posizione del primo carattere
 {
-    uint8_t TempChar;
-    do
+    const uint8_t *glyph[MAX_X / 8];
+    uint16_t n;
+
+    while( *str != 0 )
     {
-        TempChar = *str++;  
-        PutChar( Xpos, Ypos, TempChar, Color, bkColor );    
+        /* i caratteri che entrano interi nella riga vanno in un'unica finestra */
+        n = 0;
+        while( str[n] != 0 && Xpos + 8 * (n + 1) <= MAX_X )
+        {
+            glyph[n] = GetASCIIGlyph( str[n] );
+            n++;
+        }
+
+        if( n > 0 )
+        {
+            LCD_BlitText( Xpos, Ypos, glyph, n, Color, bkColor );
+            str += n;
+            Xpos += 8 * (n - 1);    /* posizione dell'ultimo carattere scritto */
+        }
+        else
+        {
+            PutChar( Xpos, Ypos, *str++, Color, bkColor );
+        }
+
         if( Xpos < MAX_X - 8 )
         {
             Xpos += 8;
@@ -670,7 +1848,6 @@ void GUI_Text(uint16_t Xpos, uint16_t Ypos, uint8_t *str,uint16_t Color, uint16_
             Ypos = 0;
         }    
     }
-    while ( *str != 0 );
 }
 
 
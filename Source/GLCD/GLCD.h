@@ -87,15 +87,66 @@
 (( green >> 2 ) << 5  ) | \
 ( blue  >> 3 ))
 
+/* Polygon vertex */
+typedef struct {
+	uint16_t x, y;
+} LCD_Point;
+
+/* Max vertices of LCD_FillPolygon: its edge table is on the stack */
+#define LCD_POLY_MAX      8
+
+/* Clip rectangle, corners included (empty if x1 < x0 or y1 < y0) */
+typedef struct {
+	int16_t x0, y0, x1, y1;
+} LCD_Rect;
+
+/* Max nesting of LCD_PushClip */
+#define LCD_CLIP_DEPTH    8
+
+/* P2.0-7 are both the LCD data bus and the LEDs. Interrupts must not write them
+   (LED_xxx, FIOPIN/FIOSET/FIOCLR on P2.0-7) while the main loop draws: a write
+   in the middle of a pixel burst spoils up to 64 pixels, because the bus word
+   is kept and driven again only every 64 pixels. Drive the LEDs from the main
+   loop, e.g. when the ISR's event comes out of event_get. */
+
 /* Private function prototypes -----------------------------------------------*/
 void LCD_Initialization(void);
 void LCD_Clear(uint16_t Color);
+void LCD_SetScroll(uint16_t Line);
+void LCD_PushClip(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height);
+void LCD_PopClip(void);
+const LCD_Rect *LCD_GetClip(void);
+void LCD_FillRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t Color);
+void LCD_BeginPixels(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height);
+void LCD_PushPixel(uint16_t Color);
+void LCD_PushPixels(const uint16_t *Color,uint32_t count);
+void LCD_PushColor(uint16_t Color,uint32_t count);
+void LCD_EndPixels(void);
+void LCD_BeginRead(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height);
+void LCD_ReadPixels(uint16_t *Color,uint32_t count);
+void LCD_ReadRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t *Color);
 uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos);
 void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point);
 void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color );
+void LCD_DrawRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t Color);
+void LCD_DrawRoundRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t Radius,uint16_t Color);
+void LCD_FillRoundRect(uint16_t Xpos,uint16_t Ypos,uint16_t Width,uint16_t Height,uint16_t Radius,uint16_t Color);
+void LCD_DrawCircle(uint16_t Xpos,uint16_t Ypos,uint16_t Radius,uint16_t Color);
+void LCD_FillCircle(uint16_t Xpos,uint16_t Ypos,uint16_t Radius,uint16_t Color);
+void LCD_DrawEllipse(uint16_t Xpos,uint16_t Ypos,uint16_t Xradius,uint16_t Yradius,uint16_t Color);
+void LCD_FillEllipse(uint16_t Xpos,uint16_t Ypos,uint16_t Xradius,uint16_t Yradius,uint16_t Color);
+void LCD_DrawTriangle( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color );
+void LCD_FillTriangle( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color );
+void LCD_DrawPolygon( const LCD_Point *pt, uint8_t count, uint16_t color );
+void LCD_FillPolygon( const LCD_Point *pt, uint8_t count, uint16_t color );	/* count <= LCD_POLY_MAX, otherwise nothing is drawn */
 void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor );
 void GUI_Text(uint16_t Xpos, uint16_t Ypos, uint8_t *str,uint16_t Color, uint16_t bkColor);
 
+#ifdef GLCD_BENCH
+/* WR strobes (index + data bus cycles), benchmark target only */
+extern uint32_t LCD_BusWrites;
+#endif
+
 #endif 
 
 /*********************************************************************************************************
@@ -9,6 +9,9 @@
 #include "RIT.h"
 #include <stdbool.h>
 #include <stdio.h> 
+#include "swtimer.h"
+#include "../input/input.h"
+#include "../event/event.h"
 
 /* INCLUDES */
 // #include "../led/led.h"     // Per accendere i LED
@@ -22,15 +25,25 @@ volatile int down_0 = 0; // Stato pulsante INT0
 volatile int down_1 = 0; // Stato pulsante KEY1
 volatile int down_2 = 0; // Stato pulsante KEY2
 
-/* VARIABILI PER TIMER SOFTWARE */
-volatile int soft_timer_delay = 0; 
-
 /******************************************************************************
 ** Function name:       RIT_IRQHandler
 ** Descriptions:        ISR eseguita periodicamente (es. ogni 50ms)
 ******************************************************************************/
 void RIT_IRQHandler (void)
 {           
+    uint32_t ticks, next;
+
+    /**************************************************************************
+    ** TIMER SOFTWARE (swtimer.h)
+    ** Avanza la ruota dei timer ed esegue le callback scadute. Il costo per tick
+    ** non dipende da quanti timer sono attivi.
+    ** In tickless un interrupt puo' coprire piu' tick: la ruota li recupera tutti.
+    **************************************************************************/
+    ticks = RIT_irq_ticks();
+    while(ticks--){
+        swtimer_tick();
+    }
+
     /**************************************************************************
     ** UTILITY 1: ADC START CONVERSION (Campionamento Periodico)
     ** COSA FA: Avvia una lettura del potenziometro o microfono a ogni ciclo RIT.
@@ -43,214 +56,182 @@ void RIT_IRQHandler (void)
 
     /**************************************************************************
     ** UTILITY 2: LED HEARTBEAT (Lampeggio di stato)
-    ** COSA FA: Inverte lo stato di un LED ogni X cicli del RIT.
+    ** COSA FA: Inverte lo stato di un LED ogni 500ms con un timer software periodico.
     ** QUANDO USARLA: Per vedere a occhio nudo se il processore  vivo e il RIT sta girando.
-    ** SE RIT = 50ms -> count > 10 significa 500ms (mezzo secondo).
+    ** Niente contatori statici nel RIT: basta avviare il timer una volta nel main.
     **************************************************************************/
     /*
-    static int led_count = 0;
-    led_count++;
-    if(led_count > 10) { // Ogni 500ms circa
-        led_count = 0;
+    // Nel main.c (dopo init_RIT):
+    static SWTIMER_t heartbeat;
+    void heartbeat_cb(void *arg) {
+        // Il LED NON si tocca qui: la callback gira nel RIT e P2.0-7 sono anche
+        // il bus dati del display (vedi GLCD.h). Si avvisa il main con un evento
+        // (code 0xFF: i timer hardware usano 0..3)
+        event_post(EVENT_TIMER, 0xFF, 0);
+    }
+    swtimer_init(&heartbeat, heartbeat_cb, 0);
+    swtimer_start(&heartbeat, swtimer_ms(500), swtimer_ms(500));
+
+    // Nel while(1) del main, per ogni evento di event_get:
+    if(ev.source == EVENT_TIMER && ev.code == 0xFF) {
         // Inverte il bit del LED (es. LED 4 su P2.3)
         // Assicurati che LPC_GPIO2->FIODIR abbia il bit 3 come uscita!
-        if(LPC_GPIO2->FIOPIN & (1<<3)) 
-             LPC_GPIO2->FIOCLR = (1<<3);
-        else 
-             LPC_GPIO2->FIOSET = (1<<3);
+        LPC_GPIO2->FIOPIN ^= (1<<3);
     }
     */
 
     /**************************************************************************
     ** UTILITY 3: SOFTWARE TIMER (Ritardo non bloccante)
-    ** COSA FA: Decrementa una variabile globale.
+    ** COSA FA: Un timer one-shot alza un flag quando scade.
     ** QUANDO USARLA: Nel main vuoi aspettare 2 secondi MA vuoi che i pulsanti continuino 
-    ** a funzionare? Imposti soft_timer_delay = 40 (se RIT=50ms) nel main e aspetti che diventi 0.
+    ** a funzionare? Si possono avere quanti timer si vuole, ognuno con la sua callback.
     **************************************************************************/
-    /*
-    if(soft_timer_delay > 0){
-        soft_timer_delay--;
-    }
-    */
 		/*
 		// Nel main.c o dove ti serve
-		extern volatile int soft_timer_delay; // Dichiari che esiste in IRQ_RIT.c
+		static volatile int pausa_finita;
+		static SWTIMER_t pausa;
+		void pausa_cb(void *arg) { pausa_finita = 1; }
 		void pausa_non_bloccante(void) {
-			soft_timer_delay = 40; // Imposta timer (40 * 50ms = 2000ms = 2 sec)
-			while(soft_timer_delay > 0) {
+			pausa_finita = 0;
+			swtimer_init(&pausa, pausa_cb, 0);
+			swtimer_start(&pausa, swtimer_ms(2000), 0); // una volta, dopo 2 sec
+			while(!pausa_finita) {
 					// Qui il processore aspetta, MA il RIT continua a girare
 					// Quindi se premi un tasto, viene rilevato (se gestito)
-					// Se usi __WFI(); risparmi anche energia
+					__WFI(); // risparmi anche energia
 			}
 		}
 		*/
 
     /**************************************************************************
-    ** GESTIONE PULSANTE INT0 (BUTTON 0)
+    ** GESTIONE PULSANTI (INT0, KEY1, KEY2) E JOYSTICK
+    ** Un'unica lettura di P1 e P2 per tick: il debounce di tutti gli ingressi
+    ** avviene in parallelo e il costo e' sempre lo stesso.
+    ** Gli eventi arrivano in input_event() (sotto), i tempi di long press e
+    ** autorepeat sono nella tabella di lib_input.c.
     **************************************************************************/
-    if(down_0 != 0){ 
-        down_0++; 
-        if((LPC_GPIO2->FIOPIN & (1<<10)) == 0){ // Se premuto (LOW)
-            switch(down_0){
-                case 2: // PRESSIONE CONFERMATA (Click normale)
+    input_scan();
+
+    /**************************************************************************
+    ** MODALITA' TICKLESS (RIT_set_tickless(1) nel main)
+    ** Con un tasto premuto o in debounce si resta a un tick; altrimenti il
+    ** prossimo interrupt e' la scadenza del primo timer software (o il
+    ** campionamento del joystick). Nessun effetto in modalita' periodica.
+    ** Decisione a interrupt spenti, dalla lettura dei timer fino alla chiusura:
+    ** fino a RIT_irq_end il flag di interrupt e' alto e RIT_wakeup non fa nulla,
+    ** quindi un EINT o uno swtimer_start arrivato in mezzo verrebbe scavalcato
+    ** da un RICOMPVAL lungo. Cosi' invece lo vede swtimer_next / input_busy.
+    **************************************************************************/
+    __disable_irq();
+    next = swtimer_next();
+    if(INPUT_IDLE_POLL != 0 && next > INPUT_IDLE_POLL){
+        next = INPUT_IDLE_POLL;
+    }
+    RIT_schedule(input_busy() ? 1 : next);
+
+    /* CHIUSURA OBBLIGATORIA DEL RIT (ancora a interrupt spenti, vedi sopra) */
+    RIT_irq_end();              // Pulisce il flag di interrupt (e azzera il contatore se periodico)
+    __enable_irq();
+    
+    return;
+}
+
+/******************************************************************************
+** Function name:       input_event
+** Descriptions:        Eventi di pulsanti e joystick generati da input_scan()
+**                      (eseguita dentro il RIT).
+** parameters:          id: INPUT_INT0 ... INPUT_J_UP, event: INPUT_PRESS,
+**                      INPUT_RELEASE, INPUT_LONG, INPUT_REPEAT
+******************************************************************************/
+void input_event(uint8_t id, uint8_t event)
+{
+    /* Ogni evento va anche in coda al main (event_get): qui sotto solo il codice
+     * che deve girare subito dentro l'interrupt. */
+    event_post(EVENT_INPUT, id, event);
+
+    switch(id){
+        /* --- INT0 (BUTTON 0) --- */
+        case INPUT_INT0:
+            switch(event){
+                case INPUT_PRESS:
                     /* --- CODICE UTENTE QUI --- */
-                    
+
                     /* UTILITY 4: ATTIVAZIONE TIMER
                      * Attiva il Timer0 */
                     // enable_timer(0); 
                     break;
-
                 /* UTILITY 5: PRESSIONE PROLUNGATA (Long Press)
                  * COSA FA: Esegue un'azione diversa se tieni premuto per 1 secondo.
-                 * CALCOLO: 1000ms / 50ms (RIT) = 20 cicli.
+                 * CALCOLO: 1000ms / 50ms (RIT) = 20 cicli (long_ticks in lib_input.c).
                  */
-                /*
-                case 20: 
+                case INPUT_LONG:
                     // Esegui azione "Long Press" 
                     break;
-                */
-                default:
+                case INPUT_RELEASE:
                     break;
+                default: break;
             }
-        }
-        else {  /* RILASCIO PULSANTE */
-            down_0 = 0;         
-            NVIC_EnableIRQ(EINT0_IRQn);             
-            LPC_PINCON->PINSEL4 |= (1 << 20); 
-        }
-    } 
+            break;
 
-    /**************************************************************************
-    ** GESTIONE PULSANTE KEY1 (BUTTON 1)
-    **************************************************************************/
-    if(down_1 != 0){
-        down_1++;
-        if((LPC_GPIO2->FIOPIN & (1<<11)) == 0){ 
-            switch(down_1){
-                case 2:
-                    /* --- CODICE UTENTE KEY1 --- */
-                    break;
-                default:
-                    break;
+        /* --- KEY1 (BUTTON 1) --- */
+        case INPUT_KEY1:
+            if(event == INPUT_PRESS){
+                /* --- CODICE UTENTE KEY1 --- */
             }
-        }
-        else {  /* Rilascio */
-            down_1 = 0;         
-            NVIC_EnableIRQ(EINT1_IRQn);
-            LPC_PINCON->PINSEL4 |= (1 << 22); 
-        }
-    } 
+            break;
 
-    /**************************************************************************
-    ** GESTIONE PULSANTE KEY2 (BUTTON 2)
-    **************************************************************************/
-    if(down_2 != 0){
-        down_2++;
-        if((LPC_GPIO2->FIOPIN & (1<<12)) == 0){ 
-            switch(down_2){
-                case 2:
-                    /* --- CODICE UTENTE KEY2 --- */
-                    break;
-                default:
-                    break;
+        /* --- KEY2 (BUTTON 2) --- */
+        case INPUT_KEY2:
+            if(event == INPUT_PRESS){
+                /* --- CODICE UTENTE KEY2 --- */
             }
-        }
-        else {  /* Rilascio */
-            down_2 = 0;     
-            NVIC_EnableIRQ(EINT2_IRQn);                         
-            LPC_PINCON->PINSEL4 |= (1 << 24); 
-        }
-    } 
+            break;
 
-    /**************************************************************************
-    ** GESTIONE JOYSTICK (Polling)
-    ** Nota: Usiamo variabili statiche perch a differenza dei pulsanti INT0/KEY1/KEY2,
-    ** il Joystick non scatena un interrupt esterno iniziale, ma viene controllato solo qui.
-    **************************************************************************/
-    static int J_up = 0;
-    static int J_down = 0;
-    static int J_left = 0;
-    static int J_right = 0;
-    static int J_select = 0; // Click centrale del joystick
-
-    /* --- JOYSTICK UP (P1.29) --- */
-    if((LPC_GPIO1->FIOPIN & (1<<29)) == 0){  
-        J_up++;
-        switch(J_up){
-            case 1:
-                /* --- CODICE UP --- */
-                break;
+        /* --- JOYSTICK UP (P1.29) --- */
+        case INPUT_J_UP:
             /* UTILITY 6: AUTO-REPEAT (Movimento continuo)
-             * COSA FA: Se tieni premuto UP, l'azione si ripete ogni tot tempo.
+             * COSA FA: Se tieni premuto UP, INPUT_REPEAT arriva ogni repeat_every tick.
              * QUANDO USARLA: Per scorrere menu o muovere un cursore velocemente.
              */
-            /*
-            default:
-                // Ogni 4 cicli RIT (200ms) ripete l'azione
-                if(J_up % 4 == 0) {
-                     // Esegui azione movimento
-                }
-                break;
-            */
-            default: break;
-        }
-    }
-    else{ J_up = 0; }
+            if(event == INPUT_PRESS || event == INPUT_REPEAT){
+                /* --- CODICE UP --- */
+            }
+            break;
 
-    /* --- JOYSTICK DOWN (P1.26) --- */
-    if((LPC_GPIO1->FIOPIN & (1<<26)) == 0){  
-        J_down++;
-        switch(J_down){
-            case 1:
+        /* --- JOYSTICK DOWN (P1.26) --- */
+        case INPUT_J_DOWN:
+            if(event == INPUT_PRESS){
                 /* --- CODICE DOWN --- */
-                break;
-            default: break;
-        }
-    }
-    else{ J_down = 0; }
+            }
+            break;
 
-    /* --- JOYSTICK LEFT (P1.27) --- */
-    if((LPC_GPIO1->FIOPIN & (1<<27)) == 0){  
-        J_left++;
-        switch(J_left){
-            case 1:
+        /* --- JOYSTICK LEFT (P1.27) --- */
+        case INPUT_J_LEFT:
+            if(event == INPUT_PRESS){
                 /* --- CODICE LEFT --- */
-                break;
-            default: break;
-        }
-    }
-    else{ J_left = 0; }
+            }
+            break;
 
-    /* --- JOYSTICK RIGHT (P1.28) --- */
-    if((LPC_GPIO1->FIOPIN & (1<<28)) == 0){  
-        J_right++;
-        switch(J_right){
-            case 1:
+        /* --- JOYSTICK RIGHT (P1.28) --- */
+        case INPUT_J_RIGHT:
+            if(event == INPUT_PRESS){
                 /* --- CODICE RIGHT --- */
-                break;
-            default: break;
-        }
-    }
-    else{ J_right = 0; }
-    
-    /* --- JOYSTICK SELECT (P1.25) - Click Centrale --- */
-    if((LPC_GPIO1->FIOPIN & (1<<25)) == 0){   
-        J_select++;
-        switch(J_select){
-            case 1:
+            }
+            break;
+
+        /* --- JOYSTICK SELECT (P1.25) - Click Centrale --- */
+        case INPUT_J_SELECT:
+            if(event == INPUT_PRESS){
                 /* --- CODICE SELECT --- */
                 // Ottimo per mettere in pausa o selezionare menu
-                break;
-            default: break;
-        }
-    }
-    else{ J_select = 0; }
+            }
+            break;
 
-    /* CHIUSURA OBBLIGATORIA DEL RIT */
-    reset_RIT();                // Azzera il contatore per il prossimo ciclo
-    LPC_RIT->RICTRL |= 0x1;     // Pulisce il flag di interrupt
-    
-    return;
+        /* DIAGONALI: due direzioni premute insieme, es.
+         * (input_get_state() & ((1<<INPUT_J_UP)|(1<<INPUT_J_LEFT))) == ((1<<INPUT_J_UP)|(1<<INPUT_J_LEFT)) */
+        default:
+            break;
+    }
 }
 
 /*********************************************************************************************************
@@ -26,6 +26,29 @@ extern void disable_RIT( void );
 /* Resetta il contatore a 0 */
 extern void reset_RIT( void );
 
+/* Intervallo impostato con init_RIT (cicli di CCLK per tick) */
+extern uint32_t RIT_get_interval( void );
+
+/* MODALITA' TICKLESS
+ * Il RIT non interrompe piu' a ogni tick: RIT_schedule programma RICOMPVAL
+ * direttamente sulla prossima scadenza. Il tempo resta contato in tick. */
+extern void RIT_set_tickless( uint8_t enable );
+
+/* Nel RIT_IRQHandler, prima di RIT_schedule: tick trascorsi con questo interrupt (1 se periodico) */
+extern uint32_t RIT_irq_ticks( void );
+
+/* Tick interi trascorsi dall'ultimo interrupt (0 se periodico) */
+extern uint32_t RIT_ticks_elapsed( void );
+
+/* Ultima istruzione del RIT_IRQHandler: azzera il contatore e pulisce il flag di interrupt */
+extern void RIT_irq_end( void );
+
+/* Nel RIT_IRQHandler: prossimo interrupt fra 'ticks' tick (solo tickless) */
+extern void RIT_schedule( uint32_t ticks );
+
+/* Da un altro interrupt o dal main: anticipa il prossimo interrupt a non oltre 'ticks' tick (0 = subito) */
+extern void RIT_wakeup( uint32_t ticks );
+
 /* Handler dell'interruzione (chiamato automaticamente) */
 extern void RIT_IRQHandler (void);
 
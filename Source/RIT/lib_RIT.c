@@ -7,6 +7,19 @@
 #include "LPC17xx.h"
 #include "RIT.h"
 
+/* Periodo di un tick in cicli di CCLK (serve a swtimer_ms) */
+static uint32_t RIT_interval = 0;
+
+/* Modalita' tickless: RICOMPVAL e' sempre un multiplo di RIT_interval */
+static uint8_t RIT_tickless = 0;
+
+/* 1 da RIT_irq_ticks a RIT_irq_end: la ruota ha gia' (o sta recuperando) i tick
+ * del match, anche se il flag di interrupt in RICTRL e' ancora alto */
+static volatile uint8_t RIT_in_irq = 0;
+
+/* Margine minimo (cicli) tra RICOUNTER e il nuovo RICOMPVAL, per non perdere il match */
+#define RIT_MARGIN      64
+
 /******************************************************************************
 ** Function name:       enable_RIT
 ** Descriptions:        Abilita il RIT impostando il bit 3 del registro RICTRL.
@@ -57,6 +70,7 @@ uint32_t init_RIT ( uint32_t RITInterval )
 
     /* 3. Impostazione Valore di Confronto */
     LPC_RIT->RICOMPVAL = RITInterval; 
+    RIT_interval = RITInterval;
 
     /* 4. Configurazione Registro di Controllo (RICTRL) */
     // Bit 1: RITENCLR -> 1 = Pulisce il contatore quando raggiunge il valore di confronto (Reset automatico)
@@ -73,4 +87,144 @@ uint32_t init_RIT ( uint32_t RITInterval )
     NVIC_SetPriority(RIT_IRQn, 5); 
 
     return (0);
-}
\ No newline at end of file
+}
+
+/******************************************************************************
+** Function name:       RIT_get_interval
+** Descriptions:        Ritorna il periodo del tick passato a init_RIT.
+******************************************************************************/
+uint32_t RIT_get_interval( void )
+{
+    return RIT_interval;
+}
+
+/******************************************************************************
+** Function name:       RIT_set_tickless
+** Descriptions:        1 = tickless, 0 = periodico (un interrupt per tick).
+**                      Il primo interrupt tickless arriva comunque dopo un tick.
+******************************************************************************/
+void RIT_set_tickless( uint8_t enable )
+{
+    RIT_tickless = enable && RIT_interval != 0;     /* serve init_RIT prima */
+    if( !enable ){
+        LPC_RIT->RICOMPVAL = RIT_interval;
+    }
+}
+
+/******************************************************************************
+** Function name:       RIT_irq_ticks
+** Descriptions:        Tick coperti dall'interrupt in corso: RICOMPVAL e' ancora
+**                      quello che ha generato il match.
+******************************************************************************/
+uint32_t RIT_irq_ticks( void )
+{
+    RIT_in_irq = 1;
+    if( !RIT_tickless ){
+        return 1;
+    }
+    return LPC_RIT->RICOMPVAL / RIT_interval;
+}
+
+/******************************************************************************
+** Function name:       RIT_ticks_elapsed
+** Descriptions:        Tick interi dall'ultimo interrupt servito. Se il match e'
+**                      gia' avvenuto ma l'interrupt e' ancora pendente, il
+**                      contatore e' ripartito da 0 e si aggiunge RICOMPVAL.
+**                      Dentro RIT_IRQHandler (callback dei timer, input_event)
+**                      quei tick sono gia' nella ruota: solo RICOUNTER.
+******************************************************************************/
+uint32_t RIT_ticks_elapsed( void )
+{
+    uint32_t ticks;
+
+    if( !RIT_tickless ){
+        return 0;
+    }
+    ticks = LPC_RIT->RICOUNTER / RIT_interval;
+    if( (LPC_RIT->RICTRL & 0x1) && !RIT_in_irq ){
+        ticks += LPC_RIT->RICOMPVAL / RIT_interval;
+    }
+    return ticks;
+}
+
+/******************************************************************************
+** Function name:       RIT_schedule
+** Descriptions:        Programma il prossimo interrupt dopo 'ticks' tick dal
+**                      match (limitato a quanto entra in RICOMPVAL). Il
+**                      contatore non viene azzerato: se l'handler ha gia'
+**                      superato quel tick si passa al primo tick ancora davanti.
+******************************************************************************/
+void RIT_schedule( uint32_t ticks )
+{
+    uint32_t max, counter;
+
+    if( !RIT_tickless ){
+        return;
+    }
+    max = 0xFFFFFFFF / RIT_interval;
+    if( ticks == 0 ){
+        ticks = 1;
+    }
+    if( ticks > max ){
+        ticks = max;
+    }
+    counter = LPC_RIT->RICOUNTER;
+    if( ticks * RIT_interval < counter + RIT_MARGIN ){
+        ticks = (counter + RIT_MARGIN) / RIT_interval + 1;
+    }
+    LPC_RIT->RICOMPVAL = ticks * RIT_interval;
+}
+
+/******************************************************************************
+** Function name:       RIT_wakeup
+** Descriptions:        Anticipa il prossimo interrupt al piu' tardi fra 'ticks'
+**                      tick da adesso, sempre su un confine di tick (cosi'
+**                      RIT_irq_ticks resta esatto). Non lo ritarda mai.
+******************************************************************************/
+void RIT_wakeup( uint32_t ticks )
+{
+    uint32_t primask, counter, compval;
+
+    if( !RIT_tickless ){
+        return;
+    }
+    if( ticks == 0 ){
+        ticks = 1;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    /* Con il match gia' avvenuto l'interrupt pendente riprogrammera' tutto */
+    if( (LPC_RIT->RICTRL & 0x1) == 0 ){
+        counter = LPC_RIT->RICOUNTER;
+        compval = (counter / RIT_interval + ticks) * RIT_interval;
+        if( compval - counter < RIT_MARGIN ){
+            compval += RIT_interval;
+        }
+        if( compval < LPC_RIT->RICOMPVAL ){
+            LPC_RIT->RICOMPVAL = compval;
+        }
+    }
+
+    if( primask == 0 ){
+        __enable_irq();
+    }
+}
+
+/******************************************************************************
+** Function name:       RIT_irq_end
+** Descriptions:        Chiusura del RIT_IRQHandler: pulisce il flag di interrupt
+**                      e poi RIT_in_irq (in quest'ordine: un interrupt in mezzo
+**                      non conta due volte RICOMPVAL). In tickless il contatore
+**                      non si azzera: RITENCLR lo ha gia' azzerato al match, e
+**                      conta anche il tempo passato nell'handler.
+******************************************************************************/
+void RIT_irq_end( void )
+{
+    if( !RIT_tickless ){
+        LPC_RIT->RICOUNTER = 0;
+    }
+    LPC_RIT->RICTRL   |= 0x1;
+    RIT_in_irq = 0;
+}
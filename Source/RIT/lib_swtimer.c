@@ -0,0 +1,256 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_swtimer.c
+** Descriptions:        Ruota di timer gerarchica a 3 livelli da 64 posizioni.
+** Start e stop costano O(1); a ogni tick si visita una sola posizione del livello 0,
+** quindi il costo non dipende da quanti timer sono attivi.
+** Correlated files:    swtimer.h, RIT.h, IRQ_RIT.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include "RIT.h"
+#include "swtimer.h"
+
+/* LIVELLI
+ * livello 0: scadenze entro 64 tick, una posizione per tick
+ * livello 1: entro 64*64 tick, una posizione ogni 64 tick
+ * livello 2: entro 64*64*64 tick (3.6 ore con RIT = 50ms)
+ * Ogni 64 tick una posizione del livello superiore viene ridistribuita ("cascade")
+ * su quelli inferiori. Le scadenze oltre il livello 2 restano in cima e vengono
+ * ridistribuite finche' non rientrano.
+ */
+#define WHEEL_BITS      6
+#define WHEEL_SIZE      (1 << WHEEL_BITS)
+#define WHEEL_MASK      (WHEEL_SIZE - 1)
+#define WHEEL_LEVELS    3
+#define WHEEL_MAX       ((1UL << (WHEEL_BITS * WHEEL_LEVELS)) - 1)
+
+static SWTIMER_t *wheel[WHEEL_LEVELS][WHEEL_SIZE];
+static volatile uint32_t wheel_now;
+
+/* Sezione critica: start/stop possono arrivare dal main mentre il RIT avanza la ruota */
+static __INLINE uint32_t wheel_lock( void )
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static __INLINE void wheel_unlock( uint32_t primask )
+{
+    if( primask == 0 ){
+        __enable_irq();
+    }
+}
+
+static void wheel_unlink( SWTIMER_t *t )
+{
+    *t->pprev = t->next;
+    if( t->next ){
+        t->next->pprev = t->pprev;
+    }
+    t->next  = 0;
+    t->pprev = 0;
+}
+
+static void wheel_insert( SWTIMER_t *t )
+{
+    SWTIMER_t **slot;
+    uint32_t delta = t->expires - wheel_now;
+
+    if( delta < WHEEL_SIZE ){
+        slot = &wheel[0][t->expires & WHEEL_MASK];
+    }
+    else if( delta < (1UL << (2 * WHEEL_BITS)) ){
+        slot = &wheel[1][(t->expires >> WHEEL_BITS) & WHEEL_MASK];
+    }
+    else {
+        if( delta > WHEEL_MAX ){                /* troppo lontano: parcheggiato in cima */
+            delta = WHEEL_MAX;
+        }
+        slot = &wheel[2][((wheel_now + delta) >> (2 * WHEEL_BITS)) & WHEEL_MASK];
+    }
+
+    t->next  = *slot;
+    t->pprev = slot;
+    if( *slot ){
+        (*slot)->pprev = &t->next;
+    }
+    *slot = t;
+}
+
+/* Ridistribuisce una posizione di un livello superiore sui livelli inferiori */
+static void wheel_cascade( SWTIMER_t **slot )
+{
+    SWTIMER_t *t = *slot;
+    SWTIMER_t *next;
+
+    *slot = 0;
+    while( t ){
+        next = t->next;
+        wheel_insert(t);
+        t = next;
+    }
+}
+
+/******************************************************************************
+** Function name:       swtimer_init
+** Descriptions:        Associa la callback a un timer, senza avviarlo.
+******************************************************************************/
+void swtimer_init( SWTIMER_t *t, SWTIMER_Callback callback, void *arg )
+{
+    t->next     = 0;
+    t->pprev    = 0;
+    t->expires  = 0;
+    t->period   = 0;
+    t->callback = callback;
+    t->arg      = arg;
+}
+
+/******************************************************************************
+** Function name:       swtimer_start
+** Descriptions:        Avvia il timer: prima scadenza dopo 'ticks' tick (minimo 1),
+**                      poi ogni 'period' tick (0 = one-shot). Se era gia' attivo
+**                      viene riprogrammato.
+******************************************************************************/
+void swtimer_start( SWTIMER_t *t, uint32_t ticks, uint32_t period )
+{
+    uint32_t primask = wheel_lock();
+
+    if( t->pprev ){
+        wheel_unlink(t);
+    }
+    if( ticks == 0 ){
+        ticks = 1;
+    }
+    /* In tickless wheel_now e' fermo all'ultimo interrupt: si conta anche il
+     * tempo gia' trascorso e si sveglia il RIT se la scadenza e' piu' vicina */
+    t->expires = wheel_now + RIT_ticks_elapsed() + ticks;
+    t->period  = period;
+    wheel_insert(t);
+    RIT_wakeup(ticks);
+
+    wheel_unlock(primask);
+}
+
+/******************************************************************************
+** Function name:       swtimer_stop
+** Descriptions:        Ferma il timer.
+******************************************************************************/
+void swtimer_stop( SWTIMER_t *t )
+{
+    uint32_t primask = wheel_lock();
+
+    if( t->pprev ){
+        wheel_unlink(t);
+    }
+
+    wheel_unlock(primask);
+}
+
+/******************************************************************************
+** Function name:       swtimer_active
+******************************************************************************/
+uint8_t swtimer_active( SWTIMER_t *t )
+{
+    return t->pprev != 0;
+}
+
+/******************************************************************************
+** Function name:       swtimer_now
+******************************************************************************/
+uint32_t swtimer_now( void )
+{
+    return wheel_now;
+}
+
+/******************************************************************************
+** Function name:       swtimer_ms
+** Descriptions:        ms -> tick del RIT. Il RIT conta a CCLK (vedi init_RIT).
+******************************************************************************/
+uint32_t swtimer_ms( uint32_t ms )
+{
+    uint64_t cycles   = (uint64_t)ms * (SystemCoreClock / 1000);
+    uint32_t interval = RIT_get_interval();
+
+    if( interval == 0 ){
+        return 0;
+    }
+    return (uint32_t)((cycles + interval - 1) / interval);
+}
+
+/******************************************************************************
+** Function name:       swtimer_tick
+** Descriptions:        Avanza di un tick. Le callback girano nel contesto del RIT
+**                      e possono avviare o fermare qualsiasi timer.
+******************************************************************************/
+void swtimer_tick( void )
+{
+    SWTIMER_t *expired, *t;
+    uint32_t now, idx;
+
+    now = ++wheel_now;
+    idx = now & WHEEL_MASK;
+
+    if( idx == 0 ){
+        if( ((now >> WHEEL_BITS) & WHEEL_MASK) == 0 ){
+            wheel_cascade(&wheel[2][(now >> (2 * WHEEL_BITS)) & WHEEL_MASK]);
+        }
+        wheel_cascade(&wheel[1][(now >> WHEEL_BITS) & WHEEL_MASK]);
+    }
+
+    /* Si stacca la lista scaduta: cosi' una callback puo' fermare anche un
+     * timer che deve ancora essere servito in questo tick. */
+    expired = wheel[0][idx];
+    wheel[0][idx] = 0;
+    if( expired ){
+        expired->pprev = &expired;
+    }
+
+    while( expired ){
+        t = expired;
+        wheel_unlink(t);
+        if( t->period ){
+            t->expires += t->period;
+            wheel_insert(t);
+        }
+        t->callback(t->arg);
+    }
+}
+
+/******************************************************************************
+** Function name:       swtimer_next
+** Descriptions:        Distanza dal prossimo tick utile: la prima posizione piena
+**                      del livello 0, oppure il primo cascade di una posizione
+**                      piena dei livelli superiori (li' si ricalcola).
+**                      Al massimo 3 * 64 letture, usata dal RIT in tickless.
+******************************************************************************/
+uint32_t swtimer_next( void )
+{
+    uint32_t now, i, next, dist;
+    uint8_t level;
+
+    now  = wheel_now;
+    next = 0xFFFFFFFF;
+
+    for( i = 1; i <= WHEEL_SIZE; i++ ){
+        if( wheel[0][(now + i) & WHEEL_MASK] ){
+            next = i;
+            break;
+        }
+    }
+
+    for( level = 1; level < WHEEL_LEVELS; level++ ){
+        for( i = 1; i <= WHEEL_SIZE; i++ ){
+            if( wheel[level][((now >> (level * WHEEL_BITS)) + i) & WHEEL_MASK] ){
+                dist = (((now >> (level * WHEEL_BITS)) + i) << (level * WHEEL_BITS)) - now;
+                if( dist < next ){
+                    next = dist;
+                }
+                break;
+            }
+        }
+    }
+
+    return next;
+}
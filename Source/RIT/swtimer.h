@@ -0,0 +1,51 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           swtimer.h
+** Descriptions:        Timer software (one-shot e periodici) con callback, su ruota gerarchica
+**                      avanzata dal RIT
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __SWTIMER_H
+#define __SWTIMER_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+
+typedef void (*SWTIMER_Callback)( void *arg );
+
+/* Un timer software. Va allocato dall'utente (statico o globale) e non va
+ * spostato ne' distrutto mentre e' attivo. I campi sono privati. */
+typedef struct SWTIMER {
+    struct SWTIMER  *next;
+    struct SWTIMER **pprev;         /* NULL = non attivo */
+    uint32_t         expires;       /* tick assoluto di scadenza */
+    uint32_t         period;        /* 0 = one-shot */
+    SWTIMER_Callback callback;
+    void            *arg;
+} SWTIMER_t;
+
+/* Prepara un timer (non lo avvia) */
+extern void swtimer_init( SWTIMER_t *t, SWTIMER_Callback callback, void *arg );
+
+/* Avvia (o riavvia) un timer: scade dopo 'ticks' tick del RIT, poi ogni 'period' tick (0 = una volta) */
+extern void swtimer_start( SWTIMER_t *t, uint32_t ticks, uint32_t period );
+
+/* Ferma un timer (nessun effetto se non e' attivo) */
+extern void swtimer_stop( SWTIMER_t *t );
+
+/* 1 se il timer e' attivo */
+extern uint8_t swtimer_active( SWTIMER_t *t );
+
+/* Tick correnti del RIT dall'avvio */
+extern uint32_t swtimer_now( void );
+
+/* Converte millisecondi in tick del RIT (arrotondando per eccesso), dopo init_RIT */
+extern uint32_t swtimer_ms( uint32_t ms );
+
+/* Avanza la ruota di un tick ed esegue le callback scadute (chiamata da RIT_IRQHandler) */
+extern void swtimer_tick( void );
+
+/* Tick fino al prossimo tick in cui la ruota ha lavoro (0xFFFFFFFF = nessun timer) */
+extern uint32_t swtimer_next( void );
+
+#endif /* end __SWTIMER_H */
@@ -23,6 +23,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include "../GLCD/GLCD.h"
 #include "../TouchPanel/TouchPanel.h"
+#include "../timer/timer.h"
+#include "../event/event.h"
+#include "../delay/delay.h"
 
 
 /* Private variables ---------------------------------------------------------*/
@@ -36,9 +39,16 @@ Coordinate DisplaySample[3] = {{ 45,  45},
 															 { 45, 270},
                                {190, 190}} ;
 
+/* Interrupt driven acquisition (TP_IRQ_Init) */
+static int           tp_buffer[2][9];
+static volatile uint8_t tp_count;
+static volatile uint8_t tp_irq_mode;
+
 /* Private define ------------------------------------------------------------*/
 #define THRESHOLD 2  
 
+#define CAL_SHIFT 16        /* Q16.16 calibration coefficients */
+
 
 /*******************************************************************************
 * Function Name  : LPC17xx_SPI_SetSpeed
@@ -107,31 +117,11 @@ void TP_Init(void)
 { 
   LPC_GPIO0->FIODIR |=  (1<<6);   /* P0.6 CS is output */
   LPC_GPIO2->FIODIR |=  (0<<13);  /* P2.13 TP_INT is input */
+  delay_init();
   TP_CS(1); 
   ADS7843_SPI_Init(); 
 } 
 
-/*******************************************************************************
-* Function Name  : DelayUS
-* Description    : ʱ1us
-* Input          : - cnt: ʱֵ
-* Output         : None
-* Return         : None
-* Attention		 : None
-*******************************************************************************/
-static void DelayUS(uint32_t cnt)
-{
-  uint32_t i;
-  for(i = 0;i<cnt;i++)
-  {
-     uint8_t us = 12; /* ֵΪ12Լ1΢ */    
-     while (us--)     /* 1΢	*/
-     {
-       ;   
-     }
-  }
-}
-
 
 /*******************************************************************************
 * Function Name  : WR_CMD
@@ -170,7 +160,7 @@ static int RD_AD(void)
 
   temp = WR_CMD(0x00);
   buf = temp<<8; 
-  DelayUS(1); 
+  delay_us(1); 
   temp = WR_CMD(0x00);;
   buf |= temp; 
   buf>>=4; 
@@ -191,9 +181,9 @@ int Read_X(void)
 {  
   int i; 
   TP_CS(0); 
-  DelayUS(1); 
+  delay_us(1); 
   WR_CMD(CHX); 
-  DelayUS(1); 
+  delay_us(1); 
   i=RD_AD(); 
   TP_CS(1); 
   return i;    
@@ -211,9 +201,9 @@ int Read_Y(void)
 {  
   int i; 
   TP_CS(0); 
-  DelayUS(1); 
+  delay_us(1); 
   WR_CMD(CHY); 
-  DelayUS(1); 
+  delay_us(1); 
   i=RD_AD(); 
   TP_CS(1); 
   return i;     
@@ -232,7 +222,7 @@ void TP_GetAdXY(int *x,int *y)
 { 
   int adx,ady; 
   adx=Read_X(); 
-  DelayUS(1); 
+  delay_us(1); 
   ady=Read_Y(); 
   *x=adx; 
   *y=ady; 
@@ -311,28 +301,18 @@ void DeleteCross(uint16_t Xpos,uint16_t Ypos)
 }
 
 /*******************************************************************************
-* Function Name  : Read_Ads7846
-* Description    : õ˲֮X Y
-* Input          : None
-* Output         : None
-* Return         : Coordinateṹַ
+* Function Name  : TP_Filter
+* Description    : Filters 9 X/Y samples: three averages of three, then the
+*                  mean of the two closest averages
+* Input          : - buffer: 9 X samples in [0], 9 Y samples in [1]
+* Output         : - screen: filtered coordinate
+* Return         : 1 if the samples are stable, 0 otherwise
 * Attention		 : None
 *******************************************************************************/
-Coordinate *Read_Ads7846(void)
+static uint8_t TP_Filter(int buffer[2][9],Coordinate *screen)
 {
-  static Coordinate  screen;
-  int m0,m1,m2,TP_X[1],TP_Y[1],temp[3];
-  uint8_t count=0;
-  int buffer[2][9]={{0},{0}}; 
-  
-	do{		   
-    TP_GetAdXY(TP_X,TP_Y);  
-		buffer[0][count]=TP_X[0];  
-		buffer[1][count]=TP_Y[0];
-		count++; 
-	}while(!TP_INT_IN&& count<9);  
-  
-	if(count==9){  
+  int m0,m1,m2,temp[3];
+
 		temp[0]=(buffer[0][0]+buffer[0][1]+buffer[0][2])/3;
 		temp[1]=(buffer[0][3]+buffer[0][4]+buffer[0][5])/3;
 		temp[2]=(buffer[0][6]+buffer[0][7]+buffer[0][8])/3;
@@ -346,14 +326,14 @@ Coordinate *Read_Ads7846(void)
 		if(m0<m1)
 		{
 			if(m2<m0) 
-				screen.x=(temp[0]+temp[2])/2;
+				screen->x=(temp[0]+temp[2])/2;
 			else 
-				screen.x=(temp[0]+temp[1])/2;	
+				screen->x=(temp[0]+temp[1])/2;	
 		}
 		else if(m2<m1) 
-			screen.x=(temp[0]+temp[2])/2;
+			screen->x=(temp[0]+temp[2])/2;
 		else 
-			screen.x=(temp[1]+temp[2])/2;
+			screen->x=(temp[1]+temp[2])/2;
 
     temp[0]=(buffer[1][0]+buffer[1][1]+buffer[1][2])/3;
 		temp[1]=(buffer[1][3]+buffer[1][4]+buffer[1][5])/3;
@@ -370,20 +350,161 @@ Coordinate *Read_Ads7846(void)
 		if(m0<m1)
 		{
 			if(m2<m0) 
-				screen.y=(temp[0]+temp[2])/2;
+				screen->y=(temp[0]+temp[2])/2;
 			else 
-				screen.y=(temp[0]+temp[1])/2;	
+				screen->y=(temp[0]+temp[1])/2;	
 			}
 		else if(m2<m1) 
-			 screen.y=(temp[0]+temp[2])/2;
+			 screen->y=(temp[0]+temp[2])/2;
 		else
-			 screen.y=(temp[1]+temp[2])/2;
+			 screen->y=(temp[1]+temp[2])/2;
+
+		return 1;
+}
 
+/*******************************************************************************
+* Function Name  : Read_Ads7846
+* Description    : õ˲֮X Y
+* Input          : None
+* Output         : None
+* Return         : Coordinateṹַ
+* Attention		 : None
+*******************************************************************************/
+Coordinate *Read_Ads7846(void)
+{
+  static Coordinate  screen;
+  int TP_X[1],TP_Y[1];
+  uint8_t count=0;
+  int buffer[2][9]={{0},{0}}; 
+  
+	do{		   
+    TP_GetAdXY(TP_X,TP_Y);  
+		buffer[0][count]=TP_X[0];  
+		buffer[1][count]=TP_Y[0];
+		count++; 
+	}while(!TP_INT_IN&& count<9);  
+  
+	if(count==9 && TP_Filter(buffer,&screen)){  
 		return &screen;
 	}  
   return 0; 
 }
+
+/*******************************************************************************
+* Function Name  : TP_IRQ_Init
+* Description    : Interrupt driven acquisition: the TP_INT (P2.13) falling
+*                  edge starts TIMER3, which takes one X/Y sample every
+*                  TP_SAMPLE_TICKS and posts a filtered EVENT_TOUCH every 9
+*                  samples until the pen is lifted. No CPU time is used while idle.
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Call after TP_Init (and TouchPanel_Calibrate, which polls).
+*                  TIMER3 and the GPIO interrupt (EINT3) are reserved.
+*******************************************************************************/
+void TP_IRQ_Init(void)
+{
+  LPC_SC->PCONP |= (1 << 23);                         /* power on TIMER3 */
+  init_timer( 3, 0, 0, 3, TP_SAMPLE_TICKS );          /* MR0: interrupt + reset */
+
+  tp_count = 0;
+  tp_irq_mode = 1;
+
+  LPC_GPIOINT->IO2IntClr  = TP_INT_PIN;
+  LPC_GPIOINT->IO2IntEnF |= TP_INT_PIN;               /* pen down = falling edge */
+  NVIC_EnableIRQ(EINT3_IRQn);
+  NVIC_SetPriority(EINT3_IRQn, 3);
+}
+
+/*******************************************************************************
+* Function Name  : EINT3_IRQHandler
+* Description    : GPIO interrupt: pen down on TP_INT starts a sampling burst
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void EINT3_IRQHandler(void)
+{
+  if( LPC_GPIOINT->IO2IntStatF & TP_INT_PIN )
+  {
+    LPC_GPIOINT->IO2IntEnF &= ~TP_INT_PIN;            /* PENIRQ toggles while converting */
+    LPC_GPIOINT->IO2IntClr  = TP_INT_PIN;
+    tp_count = 0;
+    reset_timer(3);
+    enable_timer(3);
+  }
+}
+
+/*******************************************************************************
+* Function Name  : TP_TimerTick
+* Description    : One step of the sampling burst, called by TIMER3 MR0
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Does nothing unless TP_IRQ_Init was called
+*******************************************************************************/
+void TP_TimerTick(void)
+{
+  static Coordinate last;
+  static uint8_t reported;            /* a pen down event was queued for this touch */
+  Coordinate screen;
+  int x,y;
+
+  if( !tp_irq_mode )
+  {
+    return;
+  }
+
+  if( TP_INT_IN )                                     /* pen lifted: end of burst */
+  {
+    disable_timer(3);
+    reset_timer(3);
+    if( reported )
+    {
+      event_post(EVENT_TOUCH,0,EVENT_XY(last.x,last.y));
+      reported = 0;
+    }
+    tp_count = 0;
+    LPC_GPIOINT->IO2IntClr  = TP_INT_PIN;
+    LPC_GPIOINT->IO2IntEnF |= TP_INT_PIN;
+    return;
+  }
+
+  TP_GetAdXY(&x,&y);
+  tp_buffer[0][tp_count] = x;
+  tp_buffer[1][tp_count] = y;
+  if( ++tp_count == 9 )
+  {
+    tp_count = 0;
+    if( TP_Filter(tp_buffer,&screen) )
+    {
+      last = screen;
+      reported = 1;
+      event_post(EVENT_TOUCH,1,EVENT_XY(screen.x,screen.y));
+    }
+  }
+}
 	 
+/*******************************************************************************
+* Function Name  : CalDiv
+* Description    : num / div rounded to nearest, as a Q16.16 value
+* Input          : - num, div: 64-bit numerator and divider
+* Output         : None
+* Return         : Q16.16 quotient
+* Attention		 : div must not be 0
+*******************************************************************************/
+static int32_t CalDiv( int64_t num, int64_t div )
+{
+  num *= ( 1 << CAL_SHIFT );
+  if( div < 0 )
+  {
+    num = -num;
+    div = -div;
+  }
+  return (int32_t)( ( num >= 0 ? num + div / 2 : num - div / 2 ) / div );
+}
+
 /*******************************************************************************
 * Function Name  : setCalibrationMatrix
 * Description    : computation of K A B C D E F
@@ -398,29 +519,36 @@ uint8_t setCalibrationMatrix( Coordinate * displayPtr,
 {
 
   uint8_t retTHRESHOLD = 0 ;
+  int64_t Xs0 = screenPtr[0].x,  Xs1 = screenPtr[1].x,  Xs2 = screenPtr[2].x;
+  int64_t Ys0 = screenPtr[0].y,  Ys1 = screenPtr[1].y,  Ys2 = screenPtr[2].y;
+  int64_t Xd0 = displayPtr[0].x, Xd1 = displayPtr[1].x, Xd2 = displayPtr[2].x;
+  int64_t Yd0 = displayPtr[0].y, Yd1 = displayPtr[1].y, Yd2 = displayPtr[2].y;
+  int64_t Divider;
   
-  matrixPtr->Divider = ((screenPtr[0].x - screenPtr[2].x) * (screenPtr[1].y - screenPtr[2].y)) - 
-                       ((screenPtr[1].x - screenPtr[2].x) * (screenPtr[0].y - screenPtr[2].y)) ;
-  if( matrixPtr->Divider == 0 )
+  Divider = ((Xs0 - Xs2) * (Ys1 - Ys2)) - 
+            ((Xs1 - Xs2) * (Ys0 - Ys2)) ;
+  matrixPtr->Divider = (int32_t)Divider;
+  if( Divider == 0 )
   {
     retTHRESHOLD = 1;
   }
   else
   {
-    matrixPtr->An = ((displayPtr[0].x - displayPtr[2].x) * (screenPtr[1].y - screenPtr[2].y)) - 
-                    ((displayPtr[1].x - displayPtr[2].x) * (screenPtr[0].y - screenPtr[2].y)) ;
-	  matrixPtr->Bn = ((screenPtr[0].x - screenPtr[2].x) * (displayPtr[1].x - displayPtr[2].x)) - 
-                    ((displayPtr[0].x - displayPtr[2].x) * (screenPtr[1].x - screenPtr[2].x)) ;
-    matrixPtr->Cn = (screenPtr[2].x * displayPtr[1].x - screenPtr[1].x * displayPtr[2].x) * screenPtr[0].y +
-                    (screenPtr[0].x * displayPtr[2].x - screenPtr[2].x * displayPtr[0].x) * screenPtr[1].y +
-                    (screenPtr[1].x * displayPtr[0].x - screenPtr[0].x * displayPtr[1].x) * screenPtr[2].y ;
-    matrixPtr->Dn = ((displayPtr[0].y - displayPtr[2].y) * (screenPtr[1].y - screenPtr[2].y)) - 
-                    ((displayPtr[1].y - displayPtr[2].y) * (screenPtr[0].y - screenPtr[2].y)) ;
-    matrixPtr->En = ((screenPtr[0].x - screenPtr[2].x) * (displayPtr[1].y - displayPtr[2].y)) - 
-                    ((displayPtr[0].y - displayPtr[2].y) * (screenPtr[1].x - screenPtr[2].x)) ;
-    matrixPtr->Fn = (screenPtr[2].x * displayPtr[1].y - screenPtr[1].x * displayPtr[2].y) * screenPtr[0].y +
-                    (screenPtr[0].x * displayPtr[2].y - screenPtr[2].x * displayPtr[0].y) * screenPtr[1].y +
-                    (screenPtr[1].x * displayPtr[0].y - screenPtr[0].x * displayPtr[1].y) * screenPtr[2].y ;
+    /* the 3-point solution is divided once here, getDisplayPoint only multiplies and shifts */
+    matrixPtr->An = CalDiv( ((Xd0 - Xd2) * (Ys1 - Ys2)) - 
+                            ((Xd1 - Xd2) * (Ys0 - Ys2)), Divider );
+    matrixPtr->Bn = CalDiv( ((Xs0 - Xs2) * (Xd1 - Xd2)) - 
+                            ((Xd0 - Xd2) * (Xs1 - Xs2)), Divider );
+    matrixPtr->Cn = CalDiv( (Xs2 * Xd1 - Xs1 * Xd2) * Ys0 +
+                            (Xs0 * Xd2 - Xs2 * Xd0) * Ys1 +
+                            (Xs1 * Xd0 - Xs0 * Xd1) * Ys2, Divider );
+    matrixPtr->Dn = CalDiv( ((Yd0 - Yd2) * (Ys1 - Ys2)) - 
+                            ((Yd1 - Yd2) * (Ys0 - Ys2)), Divider );
+    matrixPtr->En = CalDiv( ((Xs0 - Xs2) * (Yd1 - Yd2)) - 
+                            ((Yd0 - Yd2) * (Xs1 - Xs2)), Divider );
+    matrixPtr->Fn = CalDiv( (Xs2 * Yd1 - Xs1 * Yd2) * Ys0 +
+                            (Xs0 * Yd2 - Xs2 * Yd0) * Ys1 +
+                            (Xs1 * Yd0 - Xs0 * Yd1) * Ys2, Divider );
   }
   return( retTHRESHOLD ) ;
 }
@@ -445,13 +573,13 @@ uint8_t getDisplayPoint(Coordinate * displayPtr,
 			/* XD = AX+BY+C */        
 			displayPtr->x = ( (matrixPtr->An * screenPtr->x) + 
 												(matrixPtr->Bn * screenPtr->y) + 
-												 matrixPtr->Cn 
-											) / matrixPtr->Divider ;
+												 matrixPtr->Cn + ( 1 << ( CAL_SHIFT - 1 ) )
+											) >> CAL_SHIFT ;
 		/* YD = DX+EY+F */        
 			displayPtr->y = ( (matrixPtr->Dn * screenPtr->x) + 
 												(matrixPtr->En * screenPtr->y) + 
-												 matrixPtr->Fn 
-											) / matrixPtr->Divider ;
+												 matrixPtr->Fn + ( 1 << ( CAL_SHIFT - 1 ) )
+											) >> CAL_SHIFT ;
 		}
 		else
 		{
@@ -485,9 +613,9 @@ void TouchPanel_Calibrate(void)
   for(i=0;i<3;i++)
   {     
    #ifndef SIMULATOR
-	 DelayUS(1000 * 500);
+	 delay_ms(500);
 	 #else
-	 DelayUS(1000 * 50);
+	 delay_ms(50);
 	 #endif	
    DrawCross(DisplaySample[i].x,DisplaySample[i].y);
    do
@@ -34,9 +34,12 @@ typedef	struct POINT
 }Coordinate;
 
 
+/* XD = (An*X + Bn*Y + Cn) >> 16, YD = (Dn*X + En*Y + Fn) >> 16
+ * An..Fn are Q16.16 coefficients computed once by setCalibrationMatrix,
+ * Divider is the calibration determinant (0 = not calibrated). */
 typedef struct Matrix 
 {						
-long double An,  
+int32_t     An,  
             Bn,     
             Cn,   
             Dn,    
@@ -70,7 +73,11 @@ extern Coordinate display ;
 					else		\
 					LPC_GPIO0->FIOCLR = (1<<6)
 
-#define TP_INT_IN   ( LPC_GPIO2->FIOPIN & (1<<13) ) 
+#define TP_INT_PIN  (1<<13)
+#define TP_INT_IN   ( LPC_GPIO2->FIOPIN & TP_INT_PIN ) 
+
+/* TIMER3 paces the sampling burst: one X/Y sample every 1 ms @ PCLK 25MHz */
+#define TP_SAMPLE_TICKS   25000
 
 /* Private function prototypes -----------------------------------------------*/				
 void TP_Init(void);	
@@ -80,6 +87,9 @@ void DrawCross(uint16_t Xpos,uint16_t Ypos);
 void TP_DrawPoint(uint16_t Xpos,uint16_t Ypos);
 uint8_t setCalibrationMatrix( Coordinate * displayPtr,Coordinate * screenPtr,Matrix * matrixPtr);
 uint8_t getDisplayPoint(Coordinate * displayPtr,Coordinate * screenPtr,Matrix * matrixPtr );
+void TP_IRQ_Init(void);
+void TP_TimerTick(void);
+void EINT3_IRQHandler(void);
 
 #endif
 
@@ -10,6 +10,7 @@
 
 #include "LPC17xx.h"
 #include "adc.h"
+#include "../event/event.h"
 
 /*----------------------------------------------------------------------------
   A/D IRQ: Executed when A/D Conversion is ready (signal from ADC peripheral)
@@ -23,6 +24,7 @@ void ADC_IRQHandler(void) {
   AD_current = ((LPC_ADC->ADGDR>>4) & 0xFFF);/* Read Conversion Result             */
   if(AD_current != AD_last){
 		/* i valori vanno da 0x000 a 0xFFF */
+		event_post(EVENT_ADC, 0, AD_current);
 		
 		AD_last = AD_current;
   }	
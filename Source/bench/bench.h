@@ -0,0 +1,29 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           bench.h
+** Descriptions:        Benchmark delle primitive GLCD con il contatore di cicli DWT
+**                      (solo nel target GLCD_BENCH)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+
+/* Ripetizioni per ogni primitiva: si tiene la piu' veloce */
+#define BENCH_REPS      4
+
+typedef struct {
+    const char *name;
+    uint32_t    cycles;         /* cicli CPU per chiamata (minimo su BENCH_REPS) */
+    uint32_t    pixels;         /* pixel disegnati per chiamata */
+    uint32_t    kpix_s;         /* migliaia di pixel al secondo */
+    uint32_t    writes_x100;    /* scritture sul bus per pixel, x100 */
+} BENCH_Result;
+
+/* Esegue tutte le misure, stampa la tabella (printf su ITM) e la disegna sul display.
+ * Serve LCD_Initialization() prima. Ritorna il numero di righe in *results. */
+extern uint8_t bench_run( const BENCH_Result **results );
+
+#endif /* end __BENCH_H */
@@ -0,0 +1,193 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_bench.c
+** Descriptions:        Misura le primitive GLCD con DWT->CYCCNT: cicli per chiamata, pixel al
+** secondo e scritture sul bus per pixel (impulsi WR, contati in LCD_PulseWR). Compilato solo
+** nel target GLCD_BENCH, che usa MicroLIB: printf esce su ITM (Debug (printf) Viewer di uVision).
+** Correlated files:    bench.h, GLCD.c (LCD_BusWrites)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include <stdio.h>
+#include "bench.h"
+#include "../GLCD/GLCD.h"
+#include "../image/image.h"
+#include "../text/text.h"
+#include "../font/font.h"
+#include "../gcache/gcache.h"
+
+/* Testo di prova per GUI_Text: una riga piena */
+static uint8_t bench_text[MAX_X / 8 + 1];
+
+#define BENCH_CIRCLE_R  50
+#define BENCH_CLOCK     "12:34"
+
+static void run_empty( void )       { }
+static void run_clear( void )       { LCD_Clear(Blue); }
+static void run_fillrect( void )    { LCD_FillRect(20, 20, 100, 100, Red); }
+static void run_setpoint( void )    { LCD_SetPoint(MAX_X / 2, MAX_Y / 2, White); }
+static void run_getpoint( void )    { LCD_GetPoint(MAX_X / 2, MAX_Y / 2); }
+static void run_line_h( void )      { LCD_DrawLine(0, 10, MAX_X - 1, 10, Yellow); }
+static void run_line_v( void )      { LCD_DrawLine(10, 0, 10, MAX_Y - 1, Yellow); }
+static void run_line_d( void )      { LCD_DrawLine(0, 0, MAX_X - 1, MAX_X - 1, Yellow); }
+static void run_fillcircle( void )  { LCD_FillCircle(120, 160, BENCH_CIRCLE_R, Green); }
+static void run_filltri( void )     { LCD_FillTriangle(20, 20, 119, 20, 20, 119, Blue); }
+static void run_image( void )       { image_draw(88, 128, img_test); }
+static void run_putchar( void )     { PutChar(40, 40, 'A', White, Black); }
+static void run_gui_text( void )    { GUI_Text(0, 60, bench_text, White, Black); }
+static void run_font48( void )      { font_draw(10, 200, &font_num48, BENCH_CLOCK, White, Black); }
+static void run_font48_aa( void )   { font_draw(10, 200, &font_num48_aa, BENCH_CLOCK, White, Black); }
+static void run_gcache( void )      { gcache_text(0, 100, (const char *)bench_text, White, Black); }
+/* 6 caratteri ASCII e 4 cinesi (UTF-8): 112 pixel di larghezza */
+static void run_text_mix( void )    { text_draw(0, 80, "Punti \xe5\x88\x86\xe6\x95\xb0\xe6\x97\xb6\xe9\x97\xb4", TEXT_UTF8, White, Black); }
+
+/******************************************************************************
+** Function name:       px_circle
+** Descriptions:        Pixel di LCD_FillCircle: x^2 + y^2 <= r^2 + r, riga per riga.
+******************************************************************************/
+static uint32_t px_circle( void )
+{
+    int32_t  r = BENCH_CIRCLE_R, x = r, y;
+    uint32_t n = 0;
+
+    for( y = 0; y <= r; y++ ){
+        while( x * x + y * y > r * r + r ){
+            x--;
+        }
+        n += (y == 0) ? 2 * x + 1 : 2 * (2 * x + 1);
+    }
+    return n;
+}
+
+static uint32_t px_font48( void )    { return (uint32_t)font_width(&font_num48, BENCH_CLOCK) * font_num48.height; }
+static uint32_t px_font48_aa( void ) { return (uint32_t)font_width(&font_num48_aa, BENCH_CLOCK) * font_num48_aa.height; }
+
+typedef struct {
+    const char *name;
+    void      (*run)( void );
+    uint32_t    pixels;
+    uint32_t  (*count)( void );     /* se c'e', pixels si calcola a runtime (dipende da raggio o font) */
+} BENCH_Case;
+
+/* Per aggiungere una misura: una funzione run_xxx e una riga qui */
+static const BENCH_Case bench_case[] = {
+    { "Clear",     run_clear,     (uint32_t)MAX_X * MAX_Y },
+    { "FillRect",  run_fillrect,  100 * 100 },
+    { "SetPoint",  run_setpoint,  1 },
+    { "GetPoint",  run_getpoint,  1 },
+    { "Line H",    run_line_h,    MAX_X },
+    { "Line V",    run_line_v,    MAX_Y },
+    { "Line diag", run_line_d,    MAX_X },
+    { "Circle",    run_fillcircle,0, px_circle },
+    { "Triangle",  run_filltri,   100 * 101 / 2 },
+    { "Image",     run_image,     64 * 64 },          /* Q5, 1642 byte invece di 8192 */
+    { "PutChar",   run_putchar,   8 * 16 },
+    { "GUI_Text",  run_gui_text,  (MAX_X / 8) * 8 * 16 },
+    { "GlyphCache",run_gcache,    (MAX_X / 8) * 8 * 16 },     /* stessa riga, glifi gia' espansi */
+    { "Text mix",  run_text_mix,  112 * 16 },
+    { "Font 48",   run_font48,    0, px_font48 },
+    { "Font 48 AA",run_font48_aa, 0, px_font48_aa },    /* stessa riga a 2 bit per pixel */
+};
+
+#define BENCH_NUM   (sizeof(bench_case) / sizeof(bench_case[0]))
+
+static BENCH_Result bench_result[BENCH_NUM];
+
+/******************************************************************************
+** Function name:       fputc
+** Descriptions:        Retarget di printf (MicroLIB) sulla porta 0 dell'ITM.
+******************************************************************************/
+int fputc( int ch, FILE *f )
+{
+    ITM_SendChar(ch);
+    return ch;
+}
+
+/******************************************************************************
+** Function name:       bench_cycles
+** Descriptions:        Cicli e scritture sul bus di una chiamata, a interrupt
+**                      spenti (il RIT o il touch falserebbero la misura).
+******************************************************************************/
+static uint32_t bench_cycles( void (*run)( void ), uint32_t *writes )
+{
+    uint32_t start, cycles;
+
+    __disable_irq();
+    LCD_BusWrites = 0;
+    start = DWT->CYCCNT;
+    run();
+    cycles = DWT->CYCCNT - start;
+    *writes = LCD_BusWrites;
+    __enable_irq();
+
+    return cycles;
+}
+
+/******************************************************************************
+** Function name:       bench_run
+** Descriptions:        Misura tutte le primitive di bench_case[] e mostra la
+**                      tabella. Il costo della misura stessa (chiamata vuota)
+**                      viene sottratto.
+******************************************************************************/
+uint8_t bench_run( const BENCH_Result **results )
+{
+    BENCH_Result *r;
+    uint32_t overhead, cycles, writes, best, best_writes;
+    uint8_t i, rep;
+    char line[32];
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for( i = 0; i < MAX_X / 8; i++ ){
+        bench_text[i] = 'A' + (i % 26);
+    }
+    bench_text[i] = 0;
+
+    overhead = bench_cycles(run_empty, &writes);
+
+    for( i = 0; i < BENCH_NUM; i++ ){
+        best = 0xFFFFFFFF;
+        best_writes = 0;
+        for( rep = 0; rep < BENCH_REPS; rep++ ){
+            cycles = bench_cycles(bench_case[i].run, &writes);
+            if( cycles < best ){
+                best = cycles;
+                best_writes = writes;
+            }
+        }
+        best = (best > overhead) ? best - overhead : 1;
+
+        r = &bench_result[i];
+        r->name        = bench_case[i].name;
+        r->cycles      = best;
+        r->pixels      = bench_case[i].count ? bench_case[i].count() : bench_case[i].pixels;
+        r->kpix_s      = (uint32_t)((uint64_t)r->pixels * SystemCoreClock / best / 1000);
+        r->writes_x100 = (uint32_t)((uint64_t)best_writes * 100 / r->pixels);
+    }
+
+    /* TABELLA: su ITM per intero, sul display in forma compatta */
+    printf("\r\nGLCD bench @ %lu Hz, best of %u\r\n", (unsigned long)SystemCoreClock, BENCH_REPS);
+    printf("%-10s %10s %8s %10s %9s\r\n", "primitive", "cycles", "pixels", "kpixel/s", "writes/px");
+    for( i = 0; i < BENCH_NUM; i++ ){
+        r = &bench_result[i];
+        printf("%-10s %10lu %8lu %10lu %6lu.%02lu\r\n", r->name,
+               (unsigned long)r->cycles, (unsigned long)r->pixels, (unsigned long)r->kpix_s,
+               (unsigned long)(r->writes_x100 / 100), (unsigned long)(r->writes_x100 % 100));
+    }
+
+    LCD_Clear(Black);
+    GUI_Text(0, 0, (uint8_t *)"name      cycles  kpx/s  w/px", White, Black);
+    for( i = 0; i < BENCH_NUM; i++ ){
+        r = &bench_result[i];
+        sprintf(line, "%-9s %8lu %5lu %2lu.%02lu", r->name,
+                (unsigned long)r->cycles, (unsigned long)r->kpix_s,
+                (unsigned long)(r->writes_x100 / 100), (unsigned long)(r->writes_x100 % 100));
+        GUI_Text(0, 16 * (i + 1), (uint8_t *)line, White, Black);
+    }
+
+    if( results ){
+        *results = bench_result;
+    }
+    return BENCH_NUM;
+}
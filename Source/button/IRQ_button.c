@@ -6,6 +6,8 @@
 *********************************************************************************************************/
 #include "button.h"
 #include "LPC17xx.h"
+#include "../event/event.h"
+#include "../RIT/RIT.h"
 
 /* Variabili esterne definite in IRQ_RIT.c (o main.c) 
  * Queste bandiere dicono al RIT: "Ehi, qualcuno ha premuto il tasto!"
@@ -20,8 +22,10 @@ extern volatile int down_2;
 ******************************************************************************/
 void EINT0_IRQHandler (void)      
 {       
-    /* 1. Segnala la pressione al RIT */
+    /* 1. Segnala la pressione al RIT (debounce) e al main (fronte grezzo con timestamp) */
     down_0 = 1; 
+    event_post(EVENT_EINT, 0, 0);
+    RIT_wakeup(0);      // In tickless il RIT torna periodico per il debounce
 	
 		/**************************************************************************
     ** UTILITY 1: DEBUG HARDWARE IMMEDIATO (Test se il bottone funziona)
@@ -29,6 +33,8 @@ void EINT0_IRQHandler (void)
     ** QUANDO USARLA: Se il codice nel RIT non parte e non capisci se  colpa 
     ** del software (RIT) o dell'hardware (bottone rotto/scollegato).
     ** Se il LED si accende ma il programma non fa nulla, il problema  nel RIT.
+    ** Solo per questo test: P2.0-7 sono anche il bus dati del display (GLCD.h),
+    ** un LED scritto qui mentre il main disegna sporca una riga di pixel.
     **************************************************************************/
     /*
     LPC_GPIO2->FIOSET = (1 << 0); // Accendi LED su P2.0 (esempio)
@@ -71,6 +77,8 @@ void EINT0_IRQHandler (void)
 void EINT1_IRQHandler (void)      
 {
     down_1 = 1;
+    event_post(EVENT_EINT, 1, 0);
+    RIT_wakeup(0);
 	
 		/* UTILITY: FLAG DI START VELOCE
      * Se devi avviare un cronometro, fallo qui per la massima precisione,
@@ -91,6 +99,8 @@ void EINT1_IRQHandler (void)
 void EINT2_IRQHandler (void)      
 {
     down_2 = 1;
+    event_post(EVENT_EINT, 2, 0);
+    RIT_wakeup(0);
     NVIC_DisableIRQ(EINT2_IRQn);        
     LPC_PINCON->PINSEL4    &= ~(1 << 24);     /* GPIO mode P2.12 */
     
@@ -0,0 +1,46 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           console.h
+** Descriptions:        Console di testo a tutto schermo (font 8x16) con scorrimento hardware
+**                      dell'ILI9325: andare a capo sull'ultima riga cancella solo la riga nuova
+**                      e sposta l'inizio della visualizzazione (0x6A), senza ridisegnare il resto
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __CONSOLE_H
+#define __CONSOLE_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+#include "../GLCD/GLCD.h"
+
+/* Lo scorrimento hardware e' lungo le righe del pannello (asse da 320) */
+#if ( DISP_ORIENTATION != 0 ) && ( DISP_ORIENTATION != 180 )
+#error "console: serve DISP_ORIENTATION 0 o 180"
+#endif
+
+#define CONSOLE_COLS        ( MAX_X / 8 )       /* 30 caratteri per riga */
+#define CONSOLE_ROWS        ( MAX_Y / 16 )      /* 20 righe */
+
+/* Lunghezza massima di un console_printf (il resto viene troncato) */
+#define CONSOLE_PRINTF_MAX  128
+
+/* Pulisce lo schermo e azzera testo, cursore e scorrimento. Dopo LCD_Initialization */
+extern void console_init( uint16_t charColor, uint16_t bkColor );
+
+/* Colori del testo scritto da qui in poi (es. errori in rosso) */
+extern void console_color( uint16_t charColor, uint16_t bkColor );
+
+/* Scrive al cursore. '\n' va a capo, '\r' torna a inizio riga, gli altri caratteri
+ * di controllo sono ignorati; a fine riga si va a capo da soli */
+extern void console_putc( char c );
+extern void console_puts( const char *str );
+extern void console_printf( const char *fmt, ... );
+
+/* Ridisegna tutte le righe dal buffer (nei colori correnti), es. dopo un popup */
+extern void console_redraw( void );
+
+/* Toglie lo scorrimento: le altre primitive GLCD lavorano in coordinate GRAM, che
+ * coincidono con lo schermo solo senza scorrimento. Il contenuto va ridisegnato */
+extern void console_exit( void );
+
+#endif /* end __CONSOLE_H */
@@ -0,0 +1,200 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_console.c
+** Descriptions:        Console di testo con scorrimento hardware. Le righe di testo stanno in un
+** buffer circolare: la riga 'slot' del buffer e' disegnata alle righe GRAM slot*16..slot*16+15,
+** e il pannello parte dalla riga GRAM top*16. Andando a capo sull'ultima riga dello schermo
+** la riga in cima (top) diventa la nuova ultima: si cancella solo lei e si avanza top.
+** Correlated files:    console.h, GLCD.c (LCD_SetScroll)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "console.h"
+
+/* Testo delle righe, completato da spazi e terminato da 0 (pronto per GUI_Text) */
+static char con_text[CONSOLE_ROWS][CONSOLE_COLS + 1];
+
+static uint8_t  con_top;            /* slot mostrato in cima allo schermo */
+static uint8_t  con_row;            /* riga del cursore sullo schermo (0 = in alto) */
+static uint8_t  con_col;            /* colonna del cursore (CONSOLE_COLS = riga piena) */
+static uint16_t con_fg, con_bg;
+
+/* Slot del buffer della riga 'row' dello schermo */
+#define CON_SLOT(row)   ( (uint8_t)((con_top + (row)) % CONSOLE_ROWS) )
+
+/******************************************************************************
+** Function name:       con_clear_slot
+** Descriptions:        Svuota una riga del buffer e la cancella sul display
+**                      (una sola finestra 240x16).
+******************************************************************************/
+static void con_clear_slot( uint8_t slot )
+{
+    memset(con_text[slot], ' ', CONSOLE_COLS);
+    con_text[slot][CONSOLE_COLS] = 0;
+    LCD_FillRect(0, slot * 16, MAX_X, 16, con_bg);
+}
+
+/******************************************************************************
+** Function name:       con_newline
+** Descriptions:        Va a capo. Sull'ultima riga scorre: cancella la riga che
+**                      stava in cima, che diventa l'ultima, e sposta l'inizio
+**                      del pannello di una riga di testo.
+******************************************************************************/
+static void con_newline( void )
+{
+    con_col = 0;
+    if( con_row < CONSOLE_ROWS - 1 ){
+        con_row++;
+        return;
+    }
+    con_clear_slot(con_top);        /* prima di mostrarla, niente sfarfallio */
+    con_top = (con_top + 1) % CONSOLE_ROWS;
+    LCD_SetScroll(con_top * 16);
+}
+
+/******************************************************************************
+** Function name:       con_write
+** Descriptions:        Scrive 'len' caratteri. I caratteri stampabili consecutivi
+**                      sulla stessa riga sono disegnati con un solo GUI_Text
+**                      (una finestra GRAM per tutto il tratto).
+******************************************************************************/
+static void con_write( const char *s, uint32_t len )
+{
+    char    *line, saved;
+    uint8_t  start;
+
+    while( len != 0 ){
+        if( *s == '\n' ){
+            con_newline();
+            s++;
+            len--;
+            continue;
+        }
+        if( *s == '\r' ){
+            con_col = 0;
+            s++;
+            len--;
+            continue;
+        }
+        if( (uint8_t)*s < ' ' || (uint8_t)*s > '~' ){
+            s++;
+            len--;
+            continue;
+        }
+
+        if( con_col == CONSOLE_COLS ){      /* a capo solo quando arriva il carattere dopo */
+            con_newline();
+        }
+
+        /* tratto stampabile che entra nella riga */
+        line  = con_text[CON_SLOT(con_row)];
+        start = con_col;
+        while( len != 0 && con_col < CONSOLE_COLS && (uint8_t)*s >= ' ' && (uint8_t)*s <= '~' ){
+            line[con_col++] = *s++;
+            len--;
+        }
+
+        /* GUI_Text si ferma al terminatore: lo si mette alla fine del tratto */
+        saved = line[con_col];
+        line[con_col] = 0;
+        GUI_Text(start * 8, CON_SLOT(con_row) * 16, (uint8_t *)&line[start], con_fg, con_bg);
+        line[con_col] = saved;
+    }
+}
+
+/******************************************************************************
+** Function name:       console_init
+** Descriptions:        Schermo pulito, cursore in alto a sinistra, niente scorrimento.
+******************************************************************************/
+void console_init( uint16_t charColor, uint16_t bkColor )
+{
+    uint8_t i;
+
+    con_fg  = charColor;
+    con_bg  = bkColor;
+    con_top = 0;
+    con_row = 0;
+    con_col = 0;
+
+    LCD_SetScroll(0);
+    LCD_Clear(bkColor);
+    for( i = 0; i < CONSOLE_ROWS; i++ ){
+        memset(con_text[i], ' ', CONSOLE_COLS);
+        con_text[i][CONSOLE_COLS] = 0;
+    }
+}
+
+/******************************************************************************
+** Function name:       console_color
+** Descriptions:        Colori per il testo successivo.
+******************************************************************************/
+void console_color( uint16_t charColor, uint16_t bkColor )
+{
+    con_fg = charColor;
+    con_bg = bkColor;
+}
+
+/******************************************************************************
+** Function name:       console_putc
+** Descriptions:        Scrive un carattere al cursore.
+******************************************************************************/
+void console_putc( char c )
+{
+    con_write(&c, 1);
+}
+
+/******************************************************************************
+** Function name:       console_puts
+** Descriptions:        Scrive una stringa al cursore.
+******************************************************************************/
+void console_puts( const char *str )
+{
+    con_write(str, strlen(str));
+}
+
+/******************************************************************************
+** Function name:       console_printf
+** Descriptions:        printf sulla console, al massimo CONSOLE_PRINTF_MAX - 1
+**                      caratteri per chiamata.
+******************************************************************************/
+void console_printf( const char *fmt, ... )
+{
+    char    buf[CONSOLE_PRINTF_MAX];
+    va_list ap;
+    int     n;
+
+    va_start(ap, fmt);
+    n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+
+    if( n > 0 ){
+        con_write(buf, ((uint32_t)n < sizeof(buf)) ? (uint32_t)n : sizeof(buf) - 1);
+    }
+}
+
+/******************************************************************************
+** Function name:       console_redraw
+** Descriptions:        Ridisegna ogni riga del buffer con un GUI_Text e
+**                      ripristina lo scorrimento.
+******************************************************************************/
+void console_redraw( void )
+{
+    uint8_t i;
+
+    for( i = 0; i < CONSOLE_ROWS; i++ ){
+        GUI_Text(0, i * 16, (uint8_t *)con_text[i], con_fg, con_bg);
+    }
+    LCD_SetScroll(con_top * 16);
+}
+
+/******************************************************************************
+** Function name:       console_exit
+** Descriptions:        Riporta il pannello a GRAM = schermo.
+******************************************************************************/
+void console_exit( void )
+{
+    LCD_SetScroll(0);
+}
@@ -0,0 +1,45 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           delay.h
+** Descriptions:        Attese espresse in ns/us/ms invece che in giri di ciclo.
+** Le attese brevi contano i cicli di DWT->CYCCNT (non dipendono dall'ottimizzazione),
+** quelle in ms dormono in wfi con SysTick.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __DELAY_H
+#define __DELAY_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+
+/* CCLK per cui sono calcolate a compile time le attese in ns (system_LPC17xx.c:
+ * 12MHz * 2 * 100 / 6 / 4 = 100MHz). Con un clock piu' basso si aspetta di piu',
+ * mai di meno: se si alza il clock va alzato anche questo valore. */
+#define DELAY_CCLK          100000000UL
+
+/* ns -> cicli di CCLK, arrotondato per eccesso (costante se ns e' costante) */
+#define DELAY_NS_CYCLES(ns) ( ((uint32_t)(ns) * (DELAY_CCLK / 1000000UL) + 999UL) / 1000UL )
+
+/* Attesa minima di 'ns' nanosecondi: per i tempi di bus dei datasheet */
+#define DELAY_NS(ns)        delay_cycles(DELAY_NS_CYCLES(ns))
+
+/* Abilita DWT->CYCCNT (idempotente). Va chiamata prima di ogni altra funzione;
+ * LCD_Initialization e TP_Init la chiamano da sole. */
+extern void delay_init( void );
+
+/* Attesa attiva di 'us' microsecondi, da SystemCoreClock */
+extern void delay_us( uint32_t us );
+
+/* Attesa di 'ms' millisecondi in wfi: la CPU dorme fra un interrupt e l'altro.
+ * Funziona anche a interrupt disabilitati. Dentro un interrupt e' un'attesa attiva
+ * (come delay_us): wfi non si sveglierebbe con SysTick a priorita' non piu' alta */
+extern void delay_ms( uint32_t ms );
+
+/* Almeno 'cycles' cicli di CCLK (qualche ciclo in piu' per la lettura di CYCCNT) */
+static __INLINE void delay_cycles( uint32_t cycles )
+{
+    uint32_t start = DWT->CYCCNT;
+    while( (DWT->CYCCNT - start) < cycles );
+}
+
+#endif /* end __DELAY_H */
@@ -0,0 +1,98 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_delay.c
+** Descriptions:        delay_us con DWT->CYCCNT, delay_ms in wfi con SysTick (one-shot per attesa).
+** SysTick resta spento fuori da delay_ms: non sveglia la CPU (vedi RIT tickless).
+** Correlated files:    delay.h
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include "delay.h"
+
+/******************************************************************************
+** Function name:       delay_init
+** Descriptions:        Avvia il contatore di cicli se non e' gia' attivo.
+******************************************************************************/
+void delay_init( void )
+{
+    if( (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0 ){
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/******************************************************************************
+** Function name:       delay_us
+** Descriptions:        Attesa attiva, a blocchi di 1ms per non uscire dai 32 bit.
+******************************************************************************/
+void delay_us( uint32_t us )
+{
+    uint32_t per_us = SystemCoreClock / 1000000;
+
+    while( us > 1000 ){
+        delay_cycles(1000 * per_us);
+        us -= 1000;
+    }
+    delay_cycles(us * per_us);
+}
+
+/******************************************************************************
+** Function name:       delay_ms
+** Descriptions:        SysTick conta al massimo 2^24 cicli (167ms a 100MHz):
+**                      le attese lunghe sono divise in blocchi.
+**                      Il controllo di COUNTFLAG e wfi avvengono a interrupt
+**                      disabilitati, altrimenti un SysTick arrivato fra i due
+**                      lascerebbe la CPU addormentata. Wfi si sveglia lo stesso
+**                      e gli altri interrupt vengono serviti fra un wfi e l'altro.
+**                      Dentro un interrupt SysTick sveglia wfi solo se ha
+**                      priorita' piu' alta di quello in corso: li' si aspetta
+**                      con DWT->CYCCNT, senza toccare la priorita' di SysTick.
+******************************************************************************/
+void delay_ms( uint32_t ms )
+{
+    uint64_t cycles = (uint64_t)ms * (SystemCoreClock / 1000);
+    uint32_t chunk, primask;
+
+    if( __get_IPSR() != 0 ){
+        while( ms-- ){
+            delay_us(1000);
+        }
+        return;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    while( cycles != 0 ){
+        chunk = (cycles > SysTick_LOAD_RELOAD_Msk + 1) ? SysTick_LOAD_RELOAD_Msk + 1 : (uint32_t)cycles;
+        if( chunk < 2 ){                        /* LOAD = 0 fermerebbe SysTick */
+            break;
+        }
+        SysTick->LOAD = chunk - 1;
+        SysTick->VAL  = 0;                      /* azzera anche COUNTFLAG */
+        SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+        while( (SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) == 0 ){
+            __WFI();
+            if( primask == 0 ){
+                __enable_irq();                 /* qui girano gli interrupt pendenti */
+                __disable_irq();
+            }
+        }
+        SysTick->CTRL = 0;
+        cycles -= chunk;
+    }
+
+    if( primask == 0 ){
+        __enable_irq();
+    }
+}
+
+/******************************************************************************
+** Function name:       SysTick_Handler
+** Descriptions:        Serve solo a svegliare la CPU: la fine dell'attesa si legge
+**                      da COUNTFLAG.
+******************************************************************************/
+void SysTick_Handler( void )
+{
+}
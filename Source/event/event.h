@@ -0,0 +1,52 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           event.h
+** Descriptions:        Coda eventi lock-free tra gli interrupt (produttori) e il main (consumatore)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __EVENT_H
+#define __EVENT_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+
+/* Numero di eventi in coda (potenza di 2) */
+#define EVENT_QUEUE_SIZE    32
+
+/* SORGENTI */
+enum {
+    EVENT_INPUT = 1,    /* code = INPUT_xxx (input.h), data = INPUT_PRESS/RELEASE/LONG/REPEAT */
+    EVENT_EINT,         /* code = 0,1,2 (INT0, KEY1, KEY2): fronte grezzo dall'handler EINT */
+    EVENT_TIMER,        /* code = numero del timer, data = match register */
+    EVENT_ADC,          /* data = valore convertito (0x000..0xFFF) */
+    EVENT_TOUCH         /* code = 1 penna giu' / 0 sollevata, data = EVENT_XY(x, y) grezzi */
+};
+
+typedef struct {
+    uint32_t time;      /* DWT->CYCCNT al momento del post (cicli CPU, vedi event_init) */
+    uint8_t  source;    /* EVENT_xxx */
+    uint8_t  code;
+    uint32_t data;
+} EVENT_t;
+
+/* Coordinate impacchettate in data */
+#define EVENT_XY(x, y)  ((uint32_t)(x) | ((uint32_t)(y) << 16))
+#define EVENT_X(data)   ((uint16_t)((data) & 0xFFFF))
+#define EVENT_Y(data)   ((uint16_t)((data) >> 16))
+
+/* Abilita il contatore di cicli DWT usato per i timestamp (la coda funziona anche senza) */
+extern void event_init( void );
+
+/* Da un interrupt qualsiasi: ritorna 1 se accodato, 0 se la coda e' piena (evento perso) */
+extern uint8_t event_post( uint8_t source, uint8_t code, uint32_t data );
+
+/* Dal main: ritorna 1 e copia il piu' vecchio evento, 0 se la coda e' vuota */
+extern uint8_t event_get( EVENT_t *ev );
+
+/* Dal main: 1 se event_get troverebbe un evento (non lo estrae) */
+extern uint8_t event_pending( void );
+
+/* Eventi persi perche' la coda era piena */
+extern uint32_t event_dropped( void );
+
+#endif /* end __EVENT_H */
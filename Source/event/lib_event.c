@@ -0,0 +1,132 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_event.c
+** Descriptions:        Coda eventi lock-free: gli interrupt accodano, il main svuota dopo wfi.
+** Nessun interrupt viene mascherato: la prenotazione del posto usa LDREX/STREX.
+** Correlated files:    event.h
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include "event.h"
+
+/* COME FUNZIONA
+ * Ogni posto ha un numero di sequenza. Un produttore prenota la posizione 'pos'
+ * incrementando event_head con LDREX/STREX: se un interrupt a priorita' piu' alta
+ * lo interrompe, l'ingresso/uscita dall'eccezione azzera il monitor esclusivo,
+ * lo STREX fallisce e si riprova con la nuova testa.
+ * Dopo aver scritto l'evento il produttore pubblica il posto (seq = pos + 1);
+ * il main legge solo posti pubblicati, quindi un produttore interrotto a meta'
+ * blocca la lettura solo fino a quando non ha finito.
+ *
+ * Il posto di 'pos' e' libero se seq + indice == pos; se e' minore il main non
+ * l'ha ancora letto (coda piena), se e' maggiore un interrupt ha gia' prenotato
+ * e pubblicato pos dopo il nostro LDREX: si rilegge la testa.
+ *
+ * In seq si salva (sequenza - indice del posto): cosi' la tabella azzerata
+ * all'avvio e' gia' una coda vuota valida, senza bisogno di init.
+ */
+typedef struct {
+    volatile uint32_t seq;
+    EVENT_t ev;
+} EVENT_Slot;
+
+static EVENT_Slot        event_slot[EVENT_QUEUE_SIZE];
+static volatile uint32_t event_head;        /* prossima posizione da prenotare (produttori) */
+static uint32_t          event_tail;        /* prossima posizione da leggere (solo main) */
+static volatile uint32_t event_lost;
+
+/******************************************************************************
+** Function name:       event_init
+** Descriptions:        Avvia il contatore di cicli DWT per i timestamp.
+******************************************************************************/
+void event_init( void )
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/******************************************************************************
+** Function name:       event_post
+** Descriptions:        Accoda un evento. Chiamabile da qualsiasi interrupt.
+** Returned value:      1 accodato, 0 coda piena
+******************************************************************************/
+uint8_t event_post( uint8_t source, uint8_t code, uint32_t data )
+{
+    EVENT_Slot *slot;
+    uint32_t pos, idx, lost;
+    int32_t  diff;
+
+    for( ;; ){
+        pos  = __LDREXW(&event_head);
+        idx  = pos & (EVENT_QUEUE_SIZE - 1);
+        slot = &event_slot[idx];
+        diff = (int32_t)(slot->seq + idx - pos);
+        if( diff < 0 ){                     /* posto non ancora letto dal main: coda piena */
+            __CLREX();
+            do {
+                lost = __LDREXW(&event_lost);
+            } while( __STREXW(lost + 1, &event_lost) != 0 );
+            return 0;
+        }
+        if( diff > 0 ){                     /* un interrupt ha preso pos fra LDREX e la lettura di seq */
+            __CLREX();
+            continue;
+        }
+        if( __STREXW(pos + 1, &event_head) == 0 ){
+            break;
+        }
+    }
+
+    slot->ev.time   = DWT->CYCCNT;
+    slot->ev.source = source;
+    slot->ev.code   = code;
+    slot->ev.data   = data;
+    __DMB();                                /* evento scritto prima di pubblicarlo */
+    slot->seq = pos + 1 - idx;
+    return 1;
+}
+
+/******************************************************************************
+** Function name:       event_get
+** Descriptions:        Estrae l'evento piu' vecchio. Solo dal main (unico consumatore).
+** Returned value:      1 evento copiato in *ev, 0 coda vuota
+******************************************************************************/
+uint8_t event_get( EVENT_t *ev )
+{
+    uint32_t idx = event_tail & (EVENT_QUEUE_SIZE - 1);
+    EVENT_Slot *slot = &event_slot[idx];
+
+    if( slot->seq + idx != event_tail + 1 ){
+        return 0;
+    }
+    __DMB();
+    *ev = slot->ev;
+    __DMB();                                /* copia finita prima di liberare il posto */
+    slot->seq = event_tail + EVENT_QUEUE_SIZE - idx;
+    event_tail++;
+    return 1;
+}
+
+/******************************************************************************
+** Function name:       event_pending
+** Descriptions:        Il posto di event_tail e' pubblicato. Per dormire senza
+**                      perdere risvegli si chiama a interrupt spenti, prima di
+**                      wfi (che si sveglia anche con PRIMASK a 1).
+** Returned value:      1 c'e' almeno un evento, 0 coda vuota
+******************************************************************************/
+uint8_t event_pending( void )
+{
+    uint32_t idx = event_tail & (EVENT_QUEUE_SIZE - 1);
+
+    return (uint8_t)(event_slot[idx].seq + idx == event_tail + 1);
+}
+
+/******************************************************************************
+** Function name:       event_dropped
+** Descriptions:        Numero di eventi persi per coda piena.
+******************************************************************************/
+uint32_t event_dropped( void )
+{
+    return event_lost;
+}
@@ -0,0 +1,76 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           fb.h
+** Descriptions:        Framebuffer ombra a 2 o 4 bit per pixel (indici di palette) nel banco AHB SRAM.
+**                      Si disegna nel framebuffer, poi fb_flush copia sul display solo i tile 16x16
+**                      cambiati, convertendo gli indici in RGB565 con la palette: niente sfarfallio
+**                      da cancella-e-ridisegna e costo sul bus proporzionale a cio' che cambia.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __FB_H
+#define __FB_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+#include "../GLCD/GLCD.h"
+
+/* Bit per pixel: 2 (4 colori) o 4 (16 colori) */
+#define FB_BPP          2
+
+/* Area del display coperta dal framebuffer (multipli di FB_TILE). IRAM2 e' di 32KB:
+ * a 2bpp entra tutto lo schermo (19200 byte), a 4bpp al massimo 240x256 (30720 byte) */
+#define FB_X            0
+#define FB_Y            0
+#define FB_W            MAX_X
+#if FB_BPP == 2
+#define FB_H            MAX_Y
+#else
+#define FB_H            256
+#endif
+
+#define FB_TILE         16                      /* lato di un tile in pixel */
+#define FB_COLORS       (1 << FB_BPP)
+#define FB_TRANSPARENT  0xFF                    /* come sfondo di fb_bitmap/fb_text: non disegnato */
+
+#if ( DISP_ORIENTATION != 0 ) && ( DISP_ORIENTATION != 180 )
+#error "fb: fb_flush scrive le finestre GRAM per righe, serve DISP_ORIENTATION 0 o 180"
+#endif
+#if ( FB_BPP != 2 ) && ( FB_BPP != 4 )
+#error "fb: FB_BPP deve essere 2 o 4"
+#endif
+#if ( FB_W % FB_TILE ) || ( FB_H % FB_TILE ) || ( FB_W / FB_TILE > 32 )
+#error "fb: FB_W e FB_H multipli di FB_TILE, al massimo 32 tile per riga"
+#endif
+#if ( FB_X + FB_W > MAX_X ) || ( FB_Y + FB_H > MAX_Y )
+#error "fb: l'area esce dallo schermo"
+#endif
+#if ( FB_W * FB_H * FB_BPP / 8 ) > 0x8000
+#error "fb: il framebuffer non entra nei 32KB di IRAM2"
+#endif
+
+/* Palette di FB_COLORS colori RGB565, framebuffer a indice 0, tutto da copiare.
+ * Le coordinate delle funzioni fb_xxx sono relative all'area (0..FB_W-1, 0..FB_H-1) */
+extern void fb_init( const uint16_t *palette );
+
+/* Cambia un colore della palette: al prossimo fb_flush si ricopia tutto */
+extern void fb_palette( uint8_t index, uint16_t color );
+
+/* Da ricopiare tutto al prossimo fb_flush (es. dopo aver disegnato sul display direttamente) */
+extern void fb_invalidate( void );
+
+/* Disegno: i tile diventano sporchi solo se un pixel cambia davvero valore */
+extern void    fb_clear( uint8_t index );
+extern void    fb_set_point( uint16_t x, uint16_t y, uint8_t index );
+extern uint8_t fb_get_point( uint16_t x, uint16_t y );
+extern void    fb_fill_rect( uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t index );
+extern void    fb_draw_line( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t index );
+
+/* Bitmap a 1 bit (MSB a sinistra, (w+7)/8 byte per riga) e testo 8x16.
+ * bg = FB_TRANSPARENT lascia i pixel di sfondo come sono */
+extern void fb_bitmap( uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bits, uint8_t fg, uint8_t bg );
+extern void fb_text( uint16_t x, uint16_t y, const char *str, uint8_t fg, uint8_t bg );
+
+/* Copia sul display i tile sporchi. Ritorna il numero di tile copiati */
+extern uint16_t fb_flush( void );
+
+#endif /* end __FB_H */
@@ -0,0 +1,268 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_fb.c
+** Descriptions:        Framebuffer ombra a indici di palette. I pixel sono impacchettati per righe,
+** il piu' a sinistra nei bit alti del byte; un byte non attraversa mai il bordo di un tile.
+** Per ogni riga di tile una maschera a 32 bit dice quali tile sono cambiati dall'ultimo flush.
+** Correlated files:    fb.h, GLCD.c (LCD_BeginPixels/LCD_PushPixels)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include <string.h>
+#include "fb.h"
+#include "../GLCD/AsciiLib.h"
+
+#define FB_PPB          ( 8 / FB_BPP )              /* pixel per byte */
+#define FB_STRIDE       ( FB_W / FB_PPB )           /* byte per riga */
+#define FB_SIZE         ( FB_STRIDE * FB_H )
+#define FB_TILES_X      ( FB_W / FB_TILE )
+#define FB_TILES_Y      ( FB_H / FB_TILE )
+#define FB_MASK         ( FB_COLORS - 1 )
+#define FB_FILL(index)  ( (uint8_t)(((index) & FB_MASK) * ((FB_BPP == 2) ? 0x55 : 0x11)) )
+
+/* Nel banco AHB SRAM (IRAM2 in sample.uvprojx), non usato dal resto del progetto:
+ * i 32KB di RAM principale restano liberi. Sezione __at di armlink, zero-init */
+static uint8_t fb_buf[FB_SIZE] __attribute__((section(".bss.ARM.__at_0x2007C000"), aligned(4)));
+
+static uint32_t fb_dirty[FB_TILES_Y];              /* bit tx = tile (tx, ty) da copiare */
+static uint16_t fb_lut[FB_COLORS];                  /* indice -> RGB565 */
+static uint16_t fb_row[FB_W];                       /* riga espansa per LCD_PushPixels */
+
+/******************************************************************************
+** Function name:       fb_write
+** Descriptions:        Scrive 'value' nei bit 'mask' di un byte; se cambia segna
+**                      sporco il tile che lo contiene.
+******************************************************************************/
+static __INLINE void fb_write( uint8_t *p, uint8_t mask, uint8_t value, uint16_t y )
+{
+    uint8_t v = (*p & ~mask) | (value & mask);
+
+    if( v != *p ){
+        *p = v;
+        fb_dirty[y / FB_TILE] |= 1UL << ((((p - fb_buf) % FB_STRIDE) * FB_PPB) / FB_TILE);
+    }
+}
+
+/******************************************************************************
+** Function name:       fb_pixel
+** Descriptions:        Un pixel, senza controllo dei limiti.
+******************************************************************************/
+static __INLINE void fb_pixel( uint16_t x, uint16_t y, uint8_t index )
+{
+    uint8_t shift = (FB_PPB - 1 - (x % FB_PPB)) * FB_BPP;
+
+    fb_write(&fb_buf[y * FB_STRIDE + x / FB_PPB], FB_MASK << shift, index << shift, y);
+}
+
+/******************************************************************************
+** Function name:       fb_init
+** Descriptions:        Palette, framebuffer a zero e tutto sporco.
+******************************************************************************/
+void fb_init( const uint16_t *palette )
+{
+    memcpy(fb_lut, palette, sizeof(fb_lut));
+    memset(fb_buf, 0, sizeof(fb_buf));
+    fb_invalidate();
+}
+
+/******************************************************************************
+** Function name:       fb_palette
+** Descriptions:        Cambia un colore: tutti i pixel con quell'indice cambiano.
+******************************************************************************/
+void fb_palette( uint8_t index, uint16_t color )
+{
+    fb_lut[index & FB_MASK] = color;
+    fb_invalidate();
+}
+
+/******************************************************************************
+** Function name:       fb_invalidate
+** Descriptions:        Segna sporchi tutti i tile.
+******************************************************************************/
+void fb_invalidate( void )
+{
+    uint8_t ty;
+
+    for( ty = 0; ty < FB_TILES_Y; ty++ ){
+        fb_dirty[ty] = (FB_TILES_X == 32) ? 0xFFFFFFFF : (1UL << FB_TILES_X) - 1;
+    }
+}
+
+/******************************************************************************
+** Function name:       fb_clear
+** Descriptions:        Tutto il framebuffer a un indice.
+******************************************************************************/
+void fb_clear( uint8_t index )
+{
+    fb_fill_rect(0, 0, FB_W, FB_H, index);
+}
+
+/******************************************************************************
+** Function name:       fb_set_point
+** Descriptions:        Un pixel (fuori dall'area: niente).
+******************************************************************************/
+void fb_set_point( uint16_t x, uint16_t y, uint8_t index )
+{
+    if( x < FB_W && y < FB_H ){
+        fb_pixel(x, y, index);
+    }
+}
+
+/******************************************************************************
+** Function name:       fb_get_point
+** Descriptions:        Indice di un pixel (0 fuori dall'area).
+******************************************************************************/
+uint8_t fb_get_point( uint16_t x, uint16_t y )
+{
+    if( x >= FB_W || y >= FB_H ){
+        return 0;
+    }
+    return (fb_buf[y * FB_STRIDE + x / FB_PPB] >> ((FB_PPB - 1 - (x % FB_PPB)) * FB_BPP)) & FB_MASK;
+}
+
+/******************************************************************************
+** Function name:       fb_fill_rect
+** Descriptions:        Rettangolo pieno, un byte (FB_PPB pixel) alla volta: solo
+**                      il primo e l'ultimo byte di ogni riga sono parziali.
+******************************************************************************/
+void fb_fill_rect( uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t index )
+{
+    uint8_t *p, *first, *last, fill = FB_FILL(index);
+    uint8_t  mfirst, mlast;
+    uint16_t x1, y1;
+
+    if( x >= FB_W || y >= FB_H || w == 0 || h == 0 ){
+        return;
+    }
+    x1 = (w > FB_W - x) ? FB_W - 1 : x + w - 1;
+    y1 = (h > FB_H - y) ? FB_H - 1 : y + h - 1;
+
+    mfirst = 0xFF >> ((x % FB_PPB) * FB_BPP);
+    mlast  = 0xFF << ((FB_PPB - 1 - (x1 % FB_PPB)) * FB_BPP);
+
+    for( ; y <= y1; y++ ){
+        first = &fb_buf[y * FB_STRIDE + x / FB_PPB];
+        last  = &fb_buf[y * FB_STRIDE + x1 / FB_PPB];
+        if( first == last ){
+            fb_write(first, mfirst & mlast, fill, y);
+            continue;
+        }
+        fb_write(first, mfirst, fill, y);
+        for( p = first + 1; p < last; p++ ){
+            fb_write(p, 0xFF, fill, y);
+        }
+        fb_write(last, mlast, fill, y);
+    }
+}
+
+/******************************************************************************
+** Function name:       fb_draw_line
+** Descriptions:        Bresenham, tutti gli ottanti, estremi compresi.
+******************************************************************************/
+void fb_draw_line( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t index )
+{
+    int32_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    int32_t dy = (y1 > y0) ? y0 - y1 : y1 - y0;         /* negativo */
+    int32_t sx = (x1 >= x0) ? 1 : -1;
+    int32_t sy = (y1 >= y0) ? 1 : -1;
+    int32_t err = dx + dy, e2;
+    int32_t x = x0, y = y0;
+
+    for( ;; ){
+        fb_set_point(x, y, index);
+        if( x == x1 && y == y1 ){
+            break;
+        }
+        e2 = 2 * err;
+        if( e2 >= dy ){
+            err += dy;
+            x += sx;
+        }
+        if( e2 <= dx ){
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+/******************************************************************************
+** Function name:       fb_bitmap
+** Descriptions:        Bitmap a 1 bit: i bit a 1 in fg, quelli a 0 in bg (se non
+**                      FB_TRANSPARENT). Tagliata ai bordi dell'area.
+******************************************************************************/
+void fb_bitmap( uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bits, uint8_t fg, uint8_t bg )
+{
+    uint16_t i, j, stride = (w + 7) / 8;
+
+    for( i = 0; i < h && y + i < FB_H; i++ ){
+        for( j = 0; j < w && x + j < FB_W; j++ ){
+            if( bits[i * stride + j / 8] & (0x80 >> (j % 8)) ){
+                fb_pixel(x + j, y + i, fg);
+            }
+            else if( bg != FB_TRANSPARENT ){
+                fb_pixel(x + j, y + i, bg);
+            }
+        }
+    }
+}
+
+/******************************************************************************
+** Function name:       fb_text
+** Descriptions:        Testo 8x16 su una riga, senza andare a capo.
+******************************************************************************/
+void fb_text( uint16_t x, uint16_t y, const char *str, uint8_t fg, uint8_t bg )
+{
+    while( *str != 0 && x < FB_W ){
+        fb_bitmap(x, y, 8, 16, GetASCIIGlyph(*str++), fg, bg);
+        x += 8;
+    }
+}
+
+/******************************************************************************
+** Function name:       fb_flush
+** Descriptions:        Per ogni gruppo di tile sporchi consecutivi su una riga,
+**                      esteso verso il basso finche' le righe sotto hanno gli
+**                      stessi tile sporchi, apre una sola finestra GRAM e la
+**                      riempie riga per riga espandendo gli indici con la
+**                      palette. Da chiamare dal main, non dagli interrupt.
+******************************************************************************/
+uint16_t fb_flush( void )
+{
+    uint32_t bits, run;
+    uint16_t tiles = 0, rows, y, i;
+    uint8_t  ty, tx, n, k, b;
+    const uint8_t *src;
+    uint16_t *dst;
+
+    for( ty = 0; ty < FB_TILES_Y; ty++ ){
+        while( (bits = fb_dirty[ty]) != 0 ){
+            /* primo gruppo di tile consecutivi */
+            for( tx = 0; (bits & (1UL << tx)) == 0; tx++ );
+            for( n = 0; tx + n < FB_TILES_X && (bits & (1UL << (tx + n))); n++ );
+            run = ((n == 32) ? 0xFFFFFFFF : (1UL << n) - 1) << tx;
+
+            /* stesse colonne sporche nelle righe di tile sotto: una finestra sola */
+            fb_dirty[ty] &= ~run;
+            for( rows = 1; ty + rows < FB_TILES_Y && (fb_dirty[ty + rows] & run) == run; rows++ ){
+                fb_dirty[ty + rows] &= ~run;
+            }
+            tiles += n * rows;
+
+            LCD_BeginPixels(FB_X + tx * FB_TILE, FB_Y + ty * FB_TILE, n * FB_TILE, rows * FB_TILE);
+            for( y = ty * FB_TILE; y < (ty + rows) * FB_TILE; y++ ){
+                src = &fb_buf[y * FB_STRIDE + (tx * FB_TILE) / FB_PPB];
+                dst = fb_row;
+                for( i = 0; i < (n * FB_TILE) / FB_PPB; i++ ){
+                    b = *src++;
+                    for( k = 0; k < FB_PPB; k++ ){
+                        *dst++ = fb_lut[b >> (8 - FB_BPP)];
+                        b <<= FB_BPP;
+                    }
+                }
+                LCD_PushPixels(fb_row, n * FB_TILE);
+            }
+            LCD_EndPixels();
+        }
+    }
+    return tiles;
+}
@@ -0,0 +1,69 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           font.h
+** Descriptions:        Font proporzionali di piu' dimensioni, generati con Host/font2c.cpp da un
+**                      TrueType: bitmap, avanzamenti e kerning sono array const in flash, niente
+**                      ingrandimenti a runtime. Le righe di bit si scandiscono a tratti: ogni
+**                      tratto dello stesso colore e' una sola scrittura (LCD_PushColor o span).
+**                      I font a 2 o 4 bit per pixel hanno l'antialiasing: il colore di ogni
+**                      livello di copertura viene da una tabella calcolata una volta per (fg, bg).
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __FONT_H
+#define __FONT_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+#include <stddef.h>
+#include "../GLCD/GLCD.h"
+
+/* Un carattere: bitmap di h righe da (w * bpp + 7) / 8 byte, bit piu' alti = colonna sinistra */
+typedef struct {
+    uint16_t offset;                /* prima riga in data */
+    uint8_t  w, h;
+    int8_t   x, y;                  /* angolo della bitmap rispetto alla penna e alla cima della riga */
+    uint8_t  adv;                   /* avanzamento della penna (0 con w = 0: carattere assente) */
+} FONT_Glyph;
+
+/* Correzione dell'avanzamento fra due caratteri (es. "AV") */
+typedef struct {
+    uint8_t  left, right;
+    int8_t   dx;
+} FONT_Kern;
+
+typedef struct {
+    uint8_t           height;       /* altezza della riga */
+    uint8_t           first, last;  /* caratteri first..last */
+    uint8_t           bpp;          /* 1, oppure 2 o 4: livelli di copertura 0..2^bpp - 1 */
+    uint16_t          nkern;
+    const FONT_Glyph *glyph;        /* last - first + 1 glifi */
+    const uint8_t    *data;
+    const FONT_Kern  *kern;         /* ordinati per (left, right), NULL se nkern = 0 */
+} FONT_Font;
+
+/* Font generati (Source/font/font_*.c, comandi nell'intestazione di ciascun file) */
+extern const FONT_Font font_sans12;     /* DejaVu Sans 12 pixel, ASCII 32-126 */
+extern const FONT_Font font_sans16;     /* DejaVu Sans 16 pixel, ASCII 32-126 */
+extern const FONT_Font font_num48;      /* DejaVu Sans Bold 48 pixel, " +-.0123456789:" */
+extern const FONT_Font font_sans16_aa;  /* come font_sans16, 4 bit per pixel */
+extern const FONT_Font font_num48_aa;   /* come font_num48, 2 bit per pixel */
+
+/* Glifi toccati dal clip raccolti per una finestra di font_draw (oltre: finestra nuova) */
+#define FONT_RUN            48
+
+/* Larghezza della riga str (somma degli avanzamenti, kerning compreso). I caratteri
+ * che il font non ha sono saltati */
+extern uint16_t font_width( const FONT_Font *f, const char *str );
+
+/* Scrive str su una riga alta f->height con lo sfondo: una finestra GRAM sulla parte
+ * visibile di [Xpos, Xpos + larghezza), tagliata al clip. Ritorna la larghezza */
+extern uint16_t font_draw( uint16_t Xpos, uint16_t Ypos, const FONT_Font *f, const char *str,
+                           uint16_t charColor, uint16_t bkColor );
+
+/* Come font_draw, ma senza sfondo: scrive solo i tratti accesi, uno span per tratto.
+ * Un font con antialiasing qui vale a soglia (copertura >= meta'): per sfumare sullo
+ * sfondo bisognerebbe rileggere la GRAM, che costa piu' del testo */
+extern uint16_t font_draw_over( uint16_t Xpos, uint16_t Ypos, const FONT_Font *f, const char *str,
+                                uint16_t charColor );
+
+#endif /* end __FONT_H */
@@ -0,0 +1,140 @@
+/* Generato da Host/font2c.cpp: DejaVu Sans Bold, 48 pixel
+ *   font2c -t DejaVuSans-Bold.ttf 48 font_num48 " +-.0123456789:"
+ * riga di 37 pixel, 1 bit per pixel, 1582 byte di bitmap, 0 coppie di kerning */
+#include "font.h"
+
+static const FONT_Glyph font_num48_glyph[27] = {
+    {     0,   0,   0,    0,   35,  17 },   /* ' ' */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,  30,  30,    5,    6,  40 },   /* '+' */
+    {   120,   0,   0,    0,    0,   0 },   /* assente */
+    {   120,  15,   7,    3,   19,  20 },   /* '-' */
+    {   134,   8,   9,    5,   27,  18 },   /* '.' */
+    {   143,   0,   0,    0,    0,   0 },   /* assente */
+    {   143,  29,  37,    2,    0,  33 },   /* '0' */
+    {   291,  24,  35,    6,    1,  33 },   /* '1' */
+    {   396,  25,  36,    4,    0,  33 },   /* '2' */
+    {   540,  26,  37,    3,    0,  33 },   /* '3' */
+    {   688,  29,  35,    2,    1,  33 },   /* '4' */
+    {   828,  26,  36,    4,    1,  33 },   /* '5' */
+    {   972,  28,  37,    3,    0,  33 },   /* '6' */
+    {  1120,  26,  35,    3,    1,  33 },   /* '7' */
+    {  1260,  27,  37,    3,    0,  33 },   /* '8' */
+    {  1408,  28,  37,    2,    0,  33 },   /* '9' */
+    {  1556,   8,  26,    5,   10,  19 },   /* ':' */
+};
+
+static const uint8_t font_num48_data[1582] = {
+    0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+    0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0x3f, 0xe0, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0x00, 0x0f,
+    0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x7f, 0xc0, 0x3f, 0xe0, 0x3f, 0xe0, 0x3f,
+    0xc0, 0x1f, 0xe0, 0x7f, 0xc0, 0x1f, 0xf0, 0x7f, 0xc0, 0x1f, 0xf0, 0x7f, 0x80, 0x1f, 0xf0, 0xff,
+    0x80, 0x0f, 0xf0, 0xff, 0x80, 0x0f, 0xf8, 0xff, 0x80, 0x0f, 0xf8, 0xff, 0x80, 0x0f, 0xf8, 0xff,
+    0x80, 0x0f, 0xf8, 0xff, 0x80, 0x0f, 0xf8, 0xff, 0x80, 0x0f, 0xf8, 0xff, 0x80, 0x0f, 0xf8, 0xff,
+    0x80, 0x0f, 0xf8, 0xff, 0x80, 0x0f, 0xf8, 0xff, 0x80, 0x0f, 0xf8, 0xff, 0x80, 0x0f, 0xf8, 0xff,
+    0x80, 0x0f, 0xf8, 0x7f, 0x80, 0x1f, 0xf0, 0x7f, 0xc0, 0x1f, 0xf0, 0x7f, 0xc0, 0x1f, 0xf0, 0x3f,
+    0xc0, 0x1f, 0xe0, 0x3f, 0xe0, 0x3f, 0xe0, 0x1f, 0xf0, 0x7f, 0xc0, 0x1f, 0xff, 0xff, 0xc0, 0x0f,
+    0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00,
+    0x3f, 0xe0, 0x00, 0x03, 0xff, 0x00, 0x3f, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0x00, 0xff, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x80, 0x00,
+    0x3f, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xfe, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0xfe, 0x07, 0xff, 0x00, 0xf0, 0x03, 0xff, 0x80, 0xc0, 0x01, 0xff, 0x80,
+    0x80, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x01, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x03, 0xfe, 0x00,
+    0x00, 0x07, 0xfc, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x3f, 0xf0, 0x00,
+    0x00, 0x7f, 0xc0, 0x00, 0x01, 0xff, 0x80, 0x00, 0x03, 0xff, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00,
+    0x0f, 0xfc, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0x80, 0x00,
+    0x3f, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0x00,
+    0x3f, 0xff, 0xff, 0x00, 0x3c, 0x07, 0xff, 0x80, 0x20, 0x01, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x01, 0xff, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xf8, 0x00,
+    0x03, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0x00,
+    0x00, 0x07, 0xff, 0x80, 0x00, 0x01, 0xff, 0x80, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xc0,
+    0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x7f, 0xc0, 0x80, 0x00, 0xff, 0xc0,
+    0xe0, 0x01, 0xff, 0xc0, 0xfc, 0x07, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0x07, 0xff, 0x00, 0x00,
+    0x00, 0x03, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00,
+    0x00, 0x1f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x7f, 0xff, 0x00,
+    0x00, 0xfe, 0xff, 0x00, 0x01, 0xfe, 0xff, 0x00, 0x01, 0xfc, 0xff, 0x00, 0x03, 0xf8, 0xff, 0x00,
+    0x07, 0xf0, 0xff, 0x00, 0x07, 0xf0, 0xff, 0x00, 0x0f, 0xe0, 0xff, 0x00, 0x1f, 0xc0, 0xff, 0x00,
+    0x1f, 0xc0, 0xff, 0x00, 0x3f, 0x80, 0xff, 0x00, 0x7f, 0x00, 0xff, 0x00, 0x7f, 0x00, 0xff, 0x00,
+    0xfe, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf8,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x7f, 0xff, 0xfe, 0x00,
+    0x7f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x00,
+    0x7f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x80, 0x00,
+    0x7f, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0x00,
+    0x7f, 0xff, 0xff, 0x00, 0x7c, 0x07, 0xff, 0x80, 0x40, 0x01, 0xff, 0x80, 0x00, 0x00, 0xff, 0xc0,
+    0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x7f, 0xc0,
+    0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x7f, 0xc0, 0x80, 0x00, 0xff, 0xc0, 0xe0, 0x01, 0xff, 0x80,
+    0xfc, 0x07, 0xff, 0x80, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xfe, 0x00,
+    0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00,
+    0x00, 0x7f, 0xff, 0x80, 0x01, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xc0,
+    0x0f, 0xff, 0xff, 0xc0, 0x1f, 0xfc, 0x07, 0xc0, 0x1f, 0xf0, 0x00, 0x40, 0x3f, 0xe0, 0x00, 0x00,
+    0x3f, 0xc0, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+    0xff, 0x0f, 0xf0, 0x00, 0xff, 0x7f, 0xfc, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xf0, 0x7f, 0xe0, 0xff, 0xc0, 0x1f, 0xe0,
+    0xff, 0xc0, 0x1f, 0xf0, 0xff, 0x80, 0x0f, 0xf0, 0xff, 0x80, 0x0f, 0xf0, 0xff, 0x80, 0x0f, 0xf0,
+    0x7f, 0x80, 0x0f, 0xf0, 0x7f, 0x80, 0x0f, 0xf0, 0x7f, 0x80, 0x0f, 0xf0, 0x3f, 0xc0, 0x1f, 0xe0,
+    0x3f, 0xc0, 0x1f, 0xe0, 0x1f, 0xf0, 0x7f, 0xe0, 0x1f, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0x80,
+    0x07, 0xff, 0xff, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xe0, 0x00,
+    0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x01, 0xfe, 0x00,
+    0x00, 0x03, 0xfe, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x07, 0xf8, 0x00,
+    0x00, 0x0f, 0xf8, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0x00,
+    0x00, 0x3f, 0xe0, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x7f, 0xc0, 0x00,
+    0x00, 0x7f, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00,
+    0x01, 0xfe, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00,
+    0x07, 0xfc, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00,
+    0x03, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x80,
+    0x3f, 0xff, 0xff, 0x80, 0x7f, 0xe0, 0xff, 0xc0, 0x7f, 0xc0, 0x7f, 0xc0, 0x7f, 0x80, 0x3f, 0xc0,
+    0x7f, 0x80, 0x3f, 0xc0, 0x7f, 0x80, 0x3f, 0xc0, 0x7f, 0x80, 0x3f, 0xc0, 0x3f, 0xc0, 0x7f, 0x80,
+    0x3f, 0xe0, 0xff, 0x80, 0x1f, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xf8, 0x00,
+    0x07, 0xff, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x80, 0x7f, 0xe0, 0xff, 0x80,
+    0x7f, 0x80, 0x3f, 0xc0, 0x7f, 0x80, 0x3f, 0xc0, 0xff, 0x00, 0x1f, 0xe0, 0xff, 0x00, 0x1f, 0xe0,
+    0xff, 0x00, 0x1f, 0xe0, 0xff, 0x00, 0x1f, 0xe0, 0xff, 0x00, 0x1f, 0xe0, 0xff, 0x80, 0x3f, 0xe0,
+    0xff, 0x80, 0x3f, 0xe0, 0x7f, 0xe0, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0x80,
+    0x1f, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xc0, 0x00,
+    0x00, 0x7f, 0xc0, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xfe, 0x00,
+    0x1f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x80, 0x7f, 0xe0, 0xff, 0x80, 0x7f, 0x80, 0x3f, 0xc0,
+    0x7f, 0x80, 0x3f, 0xc0, 0xff, 0x00, 0x1f, 0xe0, 0xff, 0x00, 0x1f, 0xe0, 0xff, 0x00, 0x1f, 0xe0,
+    0xff, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x1f, 0xf0, 0xff, 0x80, 0x3f, 0xf0,
+    0x7f, 0x80, 0x3f, 0xf0, 0x7f, 0xe0, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xf0,
+    0x1f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xef, 0xf0, 0x00, 0xff, 0x0f, 0xe0,
+    0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x3f, 0xc0,
+    0x00, 0x00, 0x7f, 0xc0, 0x20, 0x00, 0xff, 0x80, 0x3c, 0x03, 0xff, 0x80, 0x3f, 0xff, 0xff, 0x00,
+    0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xe0, 0x00,
+    0x03, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+extern const FONT_Font font_num48;
+
+const FONT_Font font_num48 = { 37, 32, 58, 1, 0, font_num48_glyph, font_num48_data, NULL };
@@ -0,0 +1,235 @@
+/* Generato da Host/font2c.cpp: DejaVu Sans Bold, 48 pixel
+ *   font2c -t -b 2 DejaVuSans-Bold.ttf 48 font_num48_aa " +-.0123456789:"
+ * riga di 37 pixel, 2 bit per pixel, 3101 byte di bitmap, 0 coppie di kerning */
+#include "font.h"
+
+static const FONT_Glyph font_num48_aa_glyph[27] = {
+    {     0,   0,   0,    0,   36,  17 },   /* ' ' */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,   0,   0,    0,    0,   0 },   /* assente */
+    {     0,  31,  31,    5,    5,  40 },   /* '+' */
+    {   248,   0,   0,    0,    0,   0 },   /* assente */
+    {   248,  16,   7,    2,   19,  20 },   /* '-' */
+    {   276,  10,  10,    4,   26,  18 },   /* '.' */
+    {   306,   0,   0,    0,    0,   0 },   /* assente */
+    {   306,  30,  37,    2,    0,  33 },   /* '0' */
+    {   602,  26,  35,    5,    1,  33 },   /* '1' */
+    {   847,  27,  36,    3,    0,  33 },   /* '2' */
+    {  1099,  27,  37,    3,    0,  33 },   /* '3' */
+    {  1358,  30,  35,    2,    1,  33 },   /* '4' */
+    {  1638,  28,  36,    3,    1,  33 },   /* '5' */
+    {  1890,  29,  37,    2,    0,  33 },   /* '6' */
+    {  2186,  27,  35,    3,    1,  33 },   /* '7' */
+    {  2431,  29,  37,    2,    0,  33 },   /* '8' */
+    {  2727,  29,  37,    2,    0,  33 },   /* '9' */
+    {  3023,   9,  26,    5,   10,  19 },   /* ':' */
+};
+
+static const uint8_t font_num48_aa_data[3101] = {
+    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xaa, 0xaa, 0xaa, 0xff, 0xfa, 0xaa, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xfd,
+    0x7f, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xfd,
+    0x7f, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xd0, 0x3f, 0xff, 0xd0, 0x3f, 0xff, 0xd0,
+    0x3f, 0xff, 0xd0, 0x3f, 0xff, 0xd0, 0x3f, 0xff, 0xd0, 0x3f, 0xff, 0xd0, 0x3f, 0xff, 0xd0, 0x3f,
+    0xff, 0xd0, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xfe, 0x40,
+    0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xfe,
+    0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x00, 0x02, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xff, 0x40, 0x2f, 0xff,
+    0xf8, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x0b, 0xff, 0xfd, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x03, 0xff,
+    0xfe, 0x00, 0x2f, 0xff, 0xf0, 0x00, 0x02, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xf0, 0x00, 0x02, 0xff,
+    0xff, 0x40, 0x3f, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0x40, 0x7f, 0xff, 0xe0, 0x00, 0x01, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xd0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0xff,
+    0xff, 0xc0, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0xff,
+    0xff, 0xc0, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0xff,
+    0xff, 0xc0, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0xff,
+    0xff, 0xc0, 0x7f, 0xff, 0xd0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xe0, 0x00, 0x01, 0xff,
+    0xff, 0x80, 0x3f, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0x40, 0x3f, 0xff, 0xf0, 0x00, 0x02, 0xff,
+    0xff, 0x40, 0x2f, 0xff, 0xf0, 0x00, 0x02, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x03, 0xff,
+    0xfe, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x0b, 0xff, 0xfd, 0x00, 0x07, 0xff, 0xff, 0x40, 0x2f, 0xff,
+    0xf8, 0x00, 0x02, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xf4, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xfe,
+    0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xfe, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xc0, 0x00,
+    0x00, 0x6b, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xbf,
+    0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xbf, 0xff, 0xff,
+    0xff, 0xc0, 0x00, 0x00, 0xbf, 0xe9, 0xbf, 0xff, 0xc0, 0x00, 0x00, 0x65, 0x00, 0x7f, 0xff, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f,
+    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x15, 0x55,
+    0xbf, 0xff, 0xd5, 0x55, 0x40, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
+    0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x01, 0x6f, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x2f, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x3f, 0xff, 0xea, 0xff, 0xff, 0xff, 0xc0,
+    0x3f, 0xf9, 0x00, 0x0b, 0xff, 0xff, 0xd0, 0x3e, 0x40, 0x00, 0x01, 0xff, 0xff, 0xe0, 0x34, 0x00,
+    0x00, 0x00, 0xbf, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xc0, 0x00,
+    0x00, 0x00, 0x02, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+    0x2f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
+    0x80, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x00,
+    0x00, 0x02, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x2f,
+    0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0xaa, 0xaa, 0xaa,
+    0xa0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x01, 0x55, 0x55, 0x40,
+    0x00, 0x00, 0x05, 0xbf, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xd0, 0x1f, 0x90, 0x00, 0x07,
+    0xff, 0xff, 0xe0, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00,
+    0x5b, 0xff, 0xff, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff,
+    0x90, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xf8, 0x00,
+    0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
+    0x00, 0x1b, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
+    0xf8, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xf4, 0xa4,
+    0x00, 0x00, 0x00, 0xbf, 0xff, 0xf4, 0xbf, 0x90, 0x00, 0x06, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xaa,
+    0xff, 0xff, 0xff, 0xe0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00,
+    0x06, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1f, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xbf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+    0x02, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+    0x1f, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+    0xbf, 0xfd, 0xff, 0xff, 0x40, 0x00, 0x00, 0x01, 0xff, 0xf5, 0xff, 0xff, 0x40, 0x00, 0x00, 0x03,
+    0xff, 0xe1, 0xff, 0xff, 0x40, 0x00, 0x00, 0x0b, 0xff, 0xc1, 0xff, 0xff, 0x40, 0x00, 0x00, 0x1f,
+    0xff, 0x41, 0xff, 0xff, 0x40, 0x00, 0x00, 0x3f, 0xfe, 0x01, 0xff, 0xff, 0x40, 0x00, 0x00, 0xbf,
+    0xfc, 0x01, 0xff, 0xff, 0x40, 0x00, 0x01, 0xff, 0xf4, 0x01, 0xff, 0xff, 0x40, 0x00, 0x03, 0xff,
+    0xe0, 0x01, 0xff, 0xff, 0x40, 0x00, 0x0b, 0xff, 0x80, 0x01, 0xff, 0xff, 0x40, 0x00, 0x1f, 0xff,
+    0x40, 0x01, 0xff, 0xff, 0x40, 0x00, 0x3f, 0xfd, 0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0xbf, 0xf8,
+    0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x6a, 0xaa,
+    0xaa, 0xaa, 0xff, 0xff, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0f, 0xff, 0xea, 0xaa, 0xaa, 0xaa, 0x40, 0x0f, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
+    0xd0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xd0, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xeb, 0xff, 0xa4, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0f, 0xfa, 0x55,
+    0x6f, 0xff, 0xff, 0xe0, 0x0e, 0x40, 0x00, 0x01, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x7f,
+    0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x60, 0x00, 0x00, 0x00,
+    0x3f, 0xff, 0xf8, 0x7e, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xf4, 0x7f, 0xe4, 0x00, 0x06, 0xff, 0xff,
+    0xf0, 0x7f, 0xff, 0xea, 0xbf, 0xff, 0xff, 0xd0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1b, 0xff, 0xff,
+    0xff, 0xff, 0xd0, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xfe,
+    0x90, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x95, 0xaf, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xe4, 0x00, 0x01,
+    0xb8, 0x00, 0x02, 0xff, 0xff, 0x40, 0x00, 0x00, 0x04, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x6b, 0xfe, 0x90,
+    0x00, 0x00, 0x2f, 0xff, 0xe6, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x3f, 0xff, 0xff, 0x90, 0x1f, 0xff,
+    0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0x40, 0x3f, 0xff, 0xfd, 0x00, 0x01, 0xff,
+    0xff, 0x80, 0x2f, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x80, 0x2f, 0xff, 0xf8, 0x00, 0x00, 0xff,
+    0xff, 0x80, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0xff,
+    0xff, 0x80, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xff, 0x80, 0x0b, 0xff, 0xfc, 0x00, 0x01, 0xff,
+    0xff, 0x40, 0x07, 0xff, 0xfd, 0x00, 0x02, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0x07, 0xff,
+    0xfe, 0x00, 0x01, 0xff, 0xff, 0xe5, 0x6f, 0xff, 0xfd, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xaa, 0xaa, 0xaa, 0xaa, 0xbf, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7f,
+    0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x2f,
+    0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xd0,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0x00,
+    0x00, 0x02, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xf4,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xd0, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x03,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x00,
+    0x1f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x02,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0b,
+    0xff, 0xff, 0x95, 0x7f, 0xff, 0xfd, 0x00, 0x0f, 0xff, 0xfd, 0x00, 0x0b, 0xff, 0xfd, 0x00, 0x1f,
+    0xff, 0xf8, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xf4, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x1f,
+    0xff, 0xf4, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xf4, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x0b,
+    0xff, 0xf8, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xf4, 0x00, 0x02,
+    0xff, 0xff, 0xea, 0xff, 0xff, 0xe0, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00,
+    0x1b, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x07,
+    0xff, 0xff, 0x40, 0x6f, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xfd, 0x00, 0x1f,
+    0xff, 0xf0, 0x00, 0x02, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0x00, 0x3f,
+    0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0x40, 0x3f, 0xff, 0xd0, 0x00, 0x00, 0xff, 0xff, 0x40, 0x3f,
+    0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0x40, 0x3f, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0x40, 0x2f,
+    0xff, 0xf4, 0x00, 0x02, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xfc, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x1f,
+    0xff, 0xff, 0x95, 0x6f, 0xff, 0xfe, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00,
+    0x2f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xbf, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
+    0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xfe, 0x55, 0xbf, 0xff, 0xe0, 0x00, 0x1f,
+    0xff, 0xf8, 0x00, 0x2f, 0xff, 0xf0, 0x00, 0x2f, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x3f,
+    0xff, 0xe0, 0x00, 0x0b, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xd0, 0x00, 0x07, 0xff, 0xfd, 0x00, 0x7f,
+    0xff, 0xd0, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xd0, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x7f,
+    0xff, 0xd0, 0x00, 0x07, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xd0, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x7f,
+    0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0x40, 0x3f, 0xff, 0xf4, 0x00, 0x1f, 0xff, 0xff, 0x40, 0x2f,
+    0xff, 0xfd, 0x00, 0xbf, 0xff, 0xff, 0x40, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x07,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xf5, 0xff, 0xff, 0x00, 0x00,
+    0x01, 0x6f, 0xfa, 0x42, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0x07,
+    0x90, 0x00, 0x02, 0xff, 0xff, 0xd0, 0x00, 0x07, 0xfe, 0xa5, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x07,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x07,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x01,
+    0xaf, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0xbf,
+    0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff,
+    0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff,
+    0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80,
+};
+
+extern const FONT_Font font_num48_aa;
+
+const FONT_Font font_num48_aa = { 37, 32, 58, 2, 0, font_num48_aa_glyph, font_num48_aa_data, NULL };
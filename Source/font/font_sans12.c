@@ -0,0 +1,171 @@
+/* Generato da Host/font2c.cpp: DejaVu Sans Book, 12 pixel
+ *   font2c DejaVuSans.ttf 12 font_sans12 "32-126"
+ * riga di 15 pixel, 1 bit per pixel, 826 byte di bitmap, 37 coppie di kerning */
+#include "font.h"
+
+static const FONT_Glyph font_sans12_glyph[95] = {
+    {     0,   0,   0,    0,   11,   4 },   /* ' ' */
+    {     0,   1,   9,    2,    3,   5 },   /* '!' */
+    {     9,   3,   3,    1,    3,   5 },   /* '"' */
+    {    12,   8,   8,    1,    4,  10 },   /* '#' */
+    {    20,   5,  11,    2,    3,   8 },   /* '$' */
+    {    31,  10,   9,    0,    3,  11 },   /* '%' */
+    {    49,   8,   9,    1,    3,  10 },   /* '&' */
+    {    58,   1,   3,    1,    3,   3 },   /* '\'' */
+    {    61,   3,  11,    1,    2,   5 },   /* '(' */
+    {    72,   3,  11,    1,    2,   5 },   /* ')' */
+    {    83,   5,   6,    1,    3,   6 },   /* '*' */
+    {    89,   7,   7,    1,    5,  10 },   /* '+' */
+    {    96,   1,   3,    1,   10,   4 },   /* ',' */
+    {    99,   3,   1,    1,    8,   4 },   /* '-' */
+    {   100,   1,   2,    1,   10,   4 },   /* '.' */
+    {   102,   4,  10,    0,    3,   4 },   /* '/' */
+    {   112,   6,   9,    1,    3,   8 },   /* '0' */
+    {   121,   5,   9,    1,    3,   8 },   /* '1' */
+    {   130,   6,   9,    1,    3,   8 },   /* '2' */
+    {   139,   6,   9,    1,    3,   8 },   /* '3' */
+    {   148,   6,   9,    1,    3,   8 },   /* '4' */
+    {   157,   6,   9,    1,    3,   8 },   /* '5' */
+    {   166,   6,   9,    1,    3,   8 },   /* '6' */
+    {   175,   6,   9,    1,    3,   8 },   /* '7' */
+    {   184,   6,   9,    1,    3,   8 },   /* '8' */
+    {   193,   6,   9,    1,    3,   8 },   /* '9' */
+    {   202,   1,   6,    1,    6,   4 },   /* ':' */
+    {   208,   1,   7,    1,    6,   4 },   /* ';' */
+    {   215,   8,   6,    1,    5,  10 },   /* '<' */
+    {   221,   8,   3,    1,    7,  10 },   /* '=' */
+    {   224,   8,   6,    1,    5,  10 },   /* '>' */
+    {   230,   5,   9,    0,    3,   6 },   /* '?' */
+    {   239,  11,  11,    1,    3,  13 },   /* '@' */
+    {   261,   8,   9,    0,    3,   8 },   /* 'A' */
+    {   270,   6,   9,    1,    3,   8 },   /* 'B' */
+    {   279,   6,   9,    1,    3,   8 },   /* 'C' */
+    {   288,   7,   9,    1,    3,   9 },   /* 'D' */
+    {   297,   6,   9,    1,    3,   8 },   /* 'E' */
+    {   306,   5,   9,    1,    3,   7 },   /* 'F' */
+    {   315,   7,   9,    1,    3,   9 },   /* 'G' */
+    {   324,   7,   9,    1,    3,   9 },   /* 'H' */
+    {   333,   1,   9,    1,    3,   3 },   /* 'I' */
+    {   342,   3,  11,   -1,    3,   3 },   /* 'J' */
+    {   353,   7,   9,    1,    3,   7 },   /* 'K' */
+    {   362,   5,   9,    1,    3,   6 },   /* 'L' */
+    {   371,   8,   9,    1,    3,  10 },   /* 'M' */
+    {   380,   7,   9,    1,    3,   9 },   /* 'N' */
+    {   389,   7,   9,    1,    3,   9 },   /* 'O' */
+    {   398,   6,   9,    1,    3,   8 },   /* 'P' */
+    {   407,   7,  11,    1,    3,   9 },   /* 'Q' */
+    {   418,   7,   9,    1,    3,   8 },   /* 'R' */
+    {   427,   6,   9,    1,    3,   8 },   /* 'S' */
+    {   436,   7,   9,    0,    3,   7 },   /* 'T' */
+    {   445,   7,   9,    1,    3,   9 },   /* 'U' */
+    {   454,  10,   9,   -1,    3,   8 },   /* 'V' */
+    {   472,  11,   9,    0,    3,  11 },   /* 'W' */
+    {   490,   7,   9,    0,    3,   7 },   /* 'X' */
+    {   499,   7,   9,    0,    3,   7 },   /* 'Y' */
+    {   508,   7,   9,    1,    3,   9 },   /* 'Z' */
+    {   517,   2,  11,    2,    3,   5 },   /* '[' */
+    {   528,   4,  10,    0,    3,   4 },   /* '\\' */
+    {   538,   2,  11,    1,    3,   5 },   /* ']' */
+    {   549,   8,   3,    1,    3,  10 },   /* '^' */
+    {   552,   6,   1,    0,   14,   6 },   /* '_' */
+    {   553,   3,   2,    1,    2,   6 },   /* '`' */
+    {   555,   6,   7,    1,    5,   8 },   /* 'a' */
+    {   562,   6,  10,    1,    2,   8 },   /* 'b' */
+    {   572,   5,   7,    1,    5,   7 },   /* 'c' */
+    {   579,   6,  10,    1,    2,   8 },   /* 'd' */
+    {   589,   6,   7,    1,    5,   8 },   /* 'e' */
+    {   596,   4,  10,    0,    2,   4 },   /* 'f' */
+    {   606,   6,  10,    1,    5,   8 },   /* 'g' */
+    {   616,   6,  10,    1,    2,   8 },   /* 'h' */
+    {   626,   1,   9,    1,    3,   3 },   /* 'i' */
+    {   635,   2,  12,    0,    3,   3 },   /* 'j' */
+    {   647,   6,  10,    1,    2,   7 },   /* 'k' */
+    {   657,   1,  10,    1,    2,   3 },   /* 'l' */
+    {   667,   9,   7,    1,    5,  11 },   /* 'm' */
+    {   681,   6,   7,    1,    5,   8 },   /* 'n' */
+    {   688,   6,   7,    1,    5,   8 },   /* 'o' */
+    {   695,   6,  10,    1,    5,   8 },   /* 'p' */
+    {   705,   6,  10,    1,    5,   8 },   /* 'q' */
+    {   715,   4,   7,    1,    5,   5 },   /* 'r' */
+    {   722,   5,   7,    1,    5,   7 },   /* 's' */
+    {   729,   4,   9,    0,    3,   5 },   /* 't' */
+    {   738,   6,   7,    1,    5,   8 },   /* 'u' */
+    {   745,   6,   7,    0,    5,   6 },   /* 'v' */
+    {   752,   9,   7,    0,    5,   9 },   /* 'w' */
+    {   766,   6,   7,    0,    5,   6 },   /* 'x' */
+    {   773,   6,  10,    0,    5,   6 },   /* 'y' */
+    {   783,   5,   7,    0,    5,   5 },   /* 'z' */
+    {   790,   5,  11,    2,    3,   8 },   /* '{' */
+    {   801,   1,  12,    2,    3,   4 },   /* '|' */
+    {   813,   5,  11,    1,    3,   8 },   /* '}' */
+    {   824,   8,   2,    1,    7,  10 },   /* '~' */
+};
+
+static const uint8_t font_sans12_data[826] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0xa0, 0xa0, 0xa0, 0x12, 0x14, 0x7f, 0x24,
+    0x24, 0xfe, 0x28, 0x48, 0x20, 0x70, 0xa8, 0xa0, 0xe0, 0x38, 0x28, 0xa8, 0x70, 0x20, 0x20, 0x61,
+    0x00, 0x92, 0x00, 0x92, 0x00, 0x94, 0x00, 0x6d, 0x80, 0x0a, 0x40, 0x12, 0x40, 0x12, 0x40, 0x21,
+    0x80, 0x30, 0x48, 0x40, 0x60, 0x51, 0x89, 0x86, 0xc4, 0x7b, 0x80, 0x80, 0x80, 0x60, 0x40, 0x40,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x60, 0xc0, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x40, 0x40, 0xc0, 0x20, 0xa8, 0x70, 0x70, 0xa8, 0x20, 0x10, 0x10, 0x10, 0xfe, 0x10, 0x10, 0x10,
+    0x80, 0x80, 0x80, 0xe0, 0x80, 0x80, 0x10, 0x10, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40, 0x80, 0x80,
+    0x78, 0x48, 0x84, 0x84, 0x84, 0x84, 0x84, 0x48, 0x78, 0xe0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0xf8, 0x78, 0x8c, 0x04, 0x04, 0x08, 0x10, 0x20, 0x40, 0xfc, 0x78, 0x84, 0x04, 0x04, 0x38,
+    0x04, 0x04, 0x84, 0x78, 0x18, 0x18, 0x28, 0x48, 0x48, 0x88, 0xfc, 0x08, 0x08, 0xf8, 0x80, 0x80,
+    0xf8, 0x0c, 0x04, 0x04, 0x8c, 0x78, 0x38, 0x44, 0x80, 0xb8, 0xcc, 0x84, 0x84, 0x4c, 0x78, 0xfc,
+    0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x78, 0x84, 0x84, 0x84, 0x78, 0x84, 0x84, 0x84,
+    0x78, 0x78, 0xc8, 0x84, 0x84, 0xcc, 0x74, 0x04, 0x88, 0x70, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x80, 0x03, 0x1e, 0xe0, 0xe0, 0x1e, 0x03, 0xff, 0x00, 0xff,
+    0xc0, 0x78, 0x07, 0x07, 0x78, 0xc0, 0x70, 0x88, 0x08, 0x10, 0x20, 0x20, 0x00, 0x20, 0x20, 0x1f,
+    0x00, 0x20, 0xc0, 0x40, 0x40, 0x8f, 0x20, 0x91, 0x20, 0x91, 0x20, 0x91, 0x40, 0x8f, 0x80, 0x40,
+    0x00, 0x20, 0x80, 0x1f, 0x00, 0x18, 0x18, 0x24, 0x24, 0x24, 0x42, 0x7e, 0x42, 0x81, 0xf8, 0x84,
+    0x84, 0x84, 0xf8, 0x84, 0x84, 0x84, 0xf8, 0x38, 0x44, 0x80, 0x80, 0x80, 0x80, 0x80, 0x44, 0x38,
+    0xf8, 0x84, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0xf8, 0xfc, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80,
+    0x80, 0xfc, 0xf8, 0x80, 0x80, 0x80, 0xf8, 0x80, 0x80, 0x80, 0x80, 0x3c, 0x42, 0x80, 0x80, 0x8e,
+    0x82, 0x82, 0x42, 0x3c, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0xc0, 0x84, 0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x88, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xf8, 0x81, 0xc3, 0xc3, 0xa5, 0xa5, 0x99, 0x99, 0x81, 0x81, 0xc2, 0xc2, 0xa2, 0xa2,
+    0x92, 0x8a, 0x8a, 0x86, 0x86, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0xf8, 0x84,
+    0x84, 0x84, 0xf8, 0x80, 0x80, 0x80, 0x80, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38,
+    0x08, 0x04, 0xf8, 0x84, 0x84, 0x84, 0xf8, 0x88, 0x84, 0x84, 0x82, 0x78, 0x84, 0x80, 0x80, 0x78,
+    0x04, 0x04, 0x84, 0x78, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0xc6, 0x7c, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00,
+    0x12, 0x00, 0x12, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x84, 0x20, 0x44, 0x40, 0x44, 0x40, 0x4a, 0x40,
+    0x2a, 0x80, 0x2a, 0x80, 0x2a, 0x80, 0x11, 0x00, 0x11, 0x00, 0xc6, 0x44, 0x28, 0x28, 0x10, 0x28,
+    0x28, 0x44, 0x82, 0x82, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0xfe, 0x02, 0x04, 0x08,
+    0x10, 0x20, 0x40, 0x80, 0xfe, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0,
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x10, 0x10, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0xc0, 0x18, 0x24, 0x42, 0xfc, 0x40, 0x20, 0x78, 0x84, 0x04, 0x7c, 0x84,
+    0x8c, 0x74, 0x80, 0x80, 0x80, 0xf8, 0xcc, 0x84, 0x84, 0x84, 0xcc, 0xf8, 0x70, 0xc8, 0x80, 0x80,
+    0x80, 0xc8, 0x70, 0x04, 0x04, 0x04, 0x7c, 0xcc, 0x84, 0x84, 0x84, 0xcc, 0x7c, 0x78, 0xcc, 0x84,
+    0xfc, 0x80, 0xc4, 0x78, 0x30, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7c, 0xcc,
+    0x84, 0x84, 0x84, 0xcc, 0x7c, 0x04, 0x4c, 0x38, 0x80, 0x80, 0x80, 0xb8, 0xc4, 0x84, 0x84, 0x84,
+    0x84, 0x84, 0x80, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x80, 0x80, 0x80, 0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90,
+    0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xf7, 0x00, 0x88, 0x80, 0x88,
+    0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0xb8, 0xc4, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x78, 0xcc, 0x84, 0x84, 0x84, 0xcc, 0x78, 0xf8, 0xcc, 0x84, 0x84, 0x84, 0xcc, 0xf8, 0x80, 0x80,
+    0x80, 0x7c, 0xcc, 0x84, 0x84, 0x84, 0xcc, 0x7c, 0x04, 0x04, 0x04, 0xb0, 0xc0, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x70, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8c, 0x74, 0x84, 0x84, 0x48, 0x48, 0x48, 0x30, 0x30,
+    0x88, 0x80, 0x88, 0x80, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x22, 0x00, 0x22, 0x00, 0x84, 0x48,
+    0x48, 0x30, 0x48, 0x48, 0x84, 0x84, 0x84, 0x48, 0x48, 0x28, 0x30, 0x10, 0x10, 0x20, 0xc0, 0xf8,
+    0x08, 0x10, 0x20, 0x40, 0x80, 0xf8, 0x38, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x20, 0x20, 0x20, 0x20,
+    0x38, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xe0, 0x20, 0x20,
+    0x20, 0x20, 0x18, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x71, 0x8e,
+};
+
+static const FONT_Kern font_sans12_kern[37] = {
+    {  45,  84, -1 }, {  45,  89, -1 }, {  70,  46, -1 }, {  70,  65, -1 }, {  70,  97, -1 }, {  70, 121, -1 },
+    {  75,  45, -1 }, {  76,  84, -1 }, {  76,  86, -1 }, {  76,  87, -1 }, {  76,  89, -1 }, {  76, 121, -1 },
+    {  80,  46, -1 }, {  84,  45, -1 }, {  84,  46, -1 }, {  84,  58, -1 }, {  84,  97, -1 }, {  84,  99, -1 },
+    {  84, 101, -1 }, {  84, 111, -1 }, {  84, 114, -1 }, {  84, 115, -1 }, {  84, 117, -1 }, {  84, 119, -1 },
+    {  84, 121, -1 }, {  86,  46, -1 }, {  87,  46, -1 }, {  89,  45, -1 }, {  89,  46, -1 }, {  89,  58, -1 },
+    {  89,  97, -1 }, {  89, 101, -1 }, {  89, 111, -1 }, {  89, 117, -1 }, { 114,  46, -1 }, { 119,  46, -1 },
+    { 121,  46, -1 },
+};
+
+extern const FONT_Font font_sans12;
+
+const FONT_Font font_sans12 = { 15, 32, 126, 1, 37, font_sans12_glyph, font_sans12_data, font_sans12_kern };
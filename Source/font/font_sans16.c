@@ -0,0 +1,215 @@
+/* Generato da Host/font2c.cpp: DejaVu Sans Book, 16 pixel
+ *   font2c DejaVuSans.ttf 16 font_sans16 "32-126"
+ * riga di 19 pixel, 1 bit per pixel, 1376 byte di bitmap, 97 coppie di kerning */
+#include "font.h"
+
+static const FONT_Glyph font_sans16_glyph[95] = {
+    {     0,   0,   0,    0,   14,   5 },   /* ' ' */
+    {     0,   1,  12,    2,    3,   6 },   /* '!' */
+    {    12,   4,   4,    1,    3,   6 },   /* '"' */
+    {    16,  11,  11,    1,    4,  13 },   /* '#' */
+    {    38,   7,  14,    2,    3,  10 },   /* '$' */
+    {    52,  13,  12,    1,    3,  15 },   /* '%' */
+    {    76,  11,  12,    1,    3,  12 },   /* '&' */
+    {   100,   1,   4,    1,    3,   3 },   /* '\'' */
+    {   104,   4,  14,    1,    3,   6 },   /* '(' */
+    {   118,   4,  14,    1,    3,   6 },   /* ')' */
+    {   132,   7,   8,    1,    3,   8 },   /* '*' */
+    {   140,   9,   9,    2,    6,  13 },   /* '+' */
+    {   158,   2,   4,    1,   13,   5 },   /* ',' */
+    {   162,   4,   1,    1,   10,   6 },   /* '-' */
+    {   163,   1,   2,    2,   13,   5 },   /* '.' */
+    {   165,   5,  13,    0,    3,   5 },   /* '/' */
+    {   178,   8,  12,    1,    3,  10 },   /* '0' */
+    {   190,   7,  12,    2,    3,  10 },   /* '1' */
+    {   202,   7,  12,    1,    3,  10 },   /* '2' */
+    {   214,   8,  12,    1,    3,  10 },   /* '3' */
+    {   226,   9,  12,    1,    3,  10 },   /* '4' */
+    {   250,   8,  12,    1,    3,  10 },   /* '5' */
+    {   262,   8,  12,    1,    3,  10 },   /* '6' */
+    {   274,   8,  12,    1,    3,  10 },   /* '7' */
+    {   286,   8,  12,    1,    3,  10 },   /* '8' */
+    {   298,   8,  12,    1,    3,  10 },   /* '9' */
+    {   310,   1,   8,    2,    7,   5 },   /* ':' */
+    {   318,   2,  10,    1,    7,   5 },   /* ';' */
+    {   328,  10,   9,    2,    6,  13 },   /* '<' */
+    {   346,  10,   4,    2,    8,  13 },   /* '=' */
+    {   354,  10,   9,    2,    6,  13 },   /* '>' */
+    {   372,   6,  12,    1,    3,   9 },   /* '?' */
+    {   384,  14,  14,    1,    3,  16 },   /* '@' */
+    {   412,  11,  12,    0,    3,  11 },   /* 'A' */
+    {   436,   9,  12,    1,    3,  11 },   /* 'B' */
+    {   460,   9,  12,    1,    3,  11 },   /* 'C' */
+    {   484,  10,  12,    1,    3,  12 },   /* 'D' */
+    {   508,   8,  12,    1,    3,  10 },   /* 'E' */
+    {   520,   7,  12,    1,    3,   9 },   /* 'F' */
+    {   532,  10,  12,    1,    3,  12 },   /* 'G' */
+    {   556,  10,  12,    1,    3,  12 },   /* 'H' */
+    {   580,   1,  12,    2,    3,   5 },   /* 'I' */
+    {   592,   3,  15,    0,    3,   5 },   /* 'J' */
+    {   607,   9,  12,    1,    3,  10 },   /* 'K' */
+    {   631,   7,  12,    1,    3,   9 },   /* 'L' */
+    {   643,  11,  12,    1,    3,  13 },   /* 'M' */
+    {   667,  10,  12,    1,    3,  12 },   /* 'N' */
+    {   691,  11,  12,    1,    3,  13 },   /* 'O' */
+    {   715,   8,  12,    1,    3,  10 },   /* 'P' */
+    {   727,  11,  14,    1,    3,  13 },   /* 'Q' */
+    {   755,  10,  12,    1,    3,  11 },   /* 'R' */
+    {   779,   8,  12,    1,    3,  10 },   /* 'S' */
+    {   791,   9,  12,    0,    3,   9 },   /* 'T' */
+    {   815,  10,  12,    1,    3,  12 },   /* 'U' */
+    {   839,  11,  12,    0,    3,  11 },   /* 'V' */
+    {   863,  15,  12,    1,    3,  17 },   /* 'W' */
+    {   887,   9,  12,    1,    3,  11 },   /* 'X' */
+    {   911,   9,  12,    0,    3,   9 },   /* 'Y' */
+    {   935,  10,  12,    1,    3,  12 },   /* 'Z' */
+    {   959,   3,  14,    1,    3,   6 },   /* '[' */
+    {   973,   5,  13,    0,    3,   5 },   /* '\\' */
+    {   986,   3,  14,    2,    3,   6 },   /* ']' */
+    {  1000,  10,   4,    2,    3,  13 },   /* '^' */
+    {  1008,   8,   1,    0,   18,   8 },   /* '_' */
+    {  1009,   4,   3,    1,    2,   8 },   /* '`' */
+    {  1012,   7,   9,    1,    6,   9 },   /* 'a' */
+    {  1021,   8,  12,    1,    3,  10 },   /* 'b' */
+    {  1033,   7,   9,    1,    6,   9 },   /* 'c' */
+    {  1042,   8,  12,    1,    3,  10 },   /* 'd' */
+    {  1054,   7,   9,    1,    6,   9 },   /* 'e' */
+    {  1063,   5,  12,    1,    3,   6 },   /* 'f' */
+    {  1075,   8,  12,    1,    6,  10 },   /* 'g' */
+    {  1087,   8,  12,    1,    3,  10 },   /* 'h' */
+    {  1099,   1,  12,    1,    3,   3 },   /* 'i' */
+    {  1111,   3,  15,   -1,    3,   3 },   /* 'j' */
+    {  1126,   8,  12,    1,    3,   9 },   /* 'k' */
+    {  1138,   1,  12,    1,    3,   3 },   /* 'l' */
+    {  1150,  13,   9,    1,    6,  15 },   /* 'm' */
+    {  1168,   8,   9,    1,    6,  10 },   /* 'n' */
+    {  1177,   8,   9,    1,    6,  10 },   /* 'o' */
+    {  1186,   8,  12,    1,    6,  10 },   /* 'p' */
+    {  1198,   8,  12,    1,    6,  10 },   /* 'q' */
+    {  1210,   5,   9,    1,    6,   7 },   /* 'r' */
+    {  1219,   7,   9,    1,    6,   9 },   /* 's' */
+    {  1228,   5,  11,    0,    4,   6 },   /* 't' */
+    {  1239,   8,   9,    1,    6,  10 },   /* 'u' */
+    {  1248,  10,   9,    0,    6,   9 },   /* 'v' */
+    {  1266,  13,   9,    0,    6,  13 },   /* 'w' */
+    {  1284,   8,   9,    1,    6,  10 },   /* 'x' */
+    {  1293,   9,  12,    0,    6,   9 },   /* 'y' */
+    {  1317,   7,   9,    1,    6,   9 },   /* 'z' */
+    {  1326,   5,  15,    2,    3,  10 },   /* '{' */
+    {  1341,   1,  16,    2,    3,   5 },   /* '|' */
+    {  1357,   5,  15,    2,    3,  10 },   /* '}' */
+    {  1372,  10,   2,    2,    9,  13 },   /* '~' */
+};
+
+static const uint8_t font_sans16_data[1376] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x90, 0x90, 0x90, 0x90,
+    0x0c, 0x80, 0x08, 0x80, 0x09, 0x80, 0x7f, 0xe0, 0x19, 0x00, 0x11, 0x00, 0x13, 0x00, 0xff, 0xc0,
+    0x32, 0x00, 0x22, 0x00, 0x26, 0x00, 0x10, 0x10, 0x7c, 0xd2, 0x90, 0x90, 0x70, 0x1c, 0x12, 0x12,
+    0x96, 0x7c, 0x10, 0x10, 0x70, 0x40, 0x88, 0x40, 0x88, 0x80, 0x89, 0x80, 0x89, 0x00, 0x72, 0x00,
+    0x02, 0x70, 0x04, 0x88, 0x0c, 0x88, 0x08, 0x88, 0x10, 0x88, 0x10, 0x70, 0x3c, 0x00, 0x62, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x20, 0x00, 0x50, 0x00, 0x88, 0x40, 0x84, 0x40, 0x82, 0x40, 0x81, 0x80,
+    0x41, 0x80, 0x3e, 0x40, 0x80, 0x80, 0x80, 0x80, 0x30, 0x60, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x40, 0x40, 0x60, 0x30, 0xc0, 0x60, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x20, 0x20, 0x60, 0xc0, 0x10, 0x10, 0x92, 0x7c, 0x38, 0xd6, 0x10, 0x10, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0xff, 0x80, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x40, 0x40,
+    0x40, 0x80, 0xf0, 0x80, 0x80, 0x08, 0x08, 0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40,
+    0xc0, 0x80, 0x3c, 0x42, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x42, 0x3c, 0x70, 0xd0,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xfe, 0x78, 0xc4, 0x82, 0x02, 0x02, 0x04,
+    0x08, 0x10, 0x20, 0x40, 0x80, 0xfe, 0x7c, 0x83, 0x01, 0x01, 0x03, 0x3c, 0x03, 0x01, 0x01, 0x01,
+    0x82, 0x7c, 0x06, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x22, 0x00, 0x42, 0x00, 0x42, 0x00,
+    0x82, 0x00, 0xff, 0x80, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x7e, 0x40, 0x40, 0x40, 0x7c, 0x42,
+    0x01, 0x01, 0x01, 0x01, 0x82, 0x7c, 0x1c, 0x62, 0x40, 0x80, 0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81,
+    0x42, 0x3c, 0xff, 0x01, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x3c, 0xc3,
+    0x81, 0x81, 0xc3, 0x3c, 0xc3, 0x81, 0x81, 0x81, 0x42, 0x3c, 0x3c, 0x42, 0x82, 0x81, 0x81, 0x81,
+    0x43, 0x3d, 0x01, 0x02, 0x46, 0x38, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x80, 0x00, 0x40, 0x03, 0x80, 0x1c, 0x00, 0x70, 0x00,
+    0x80, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x40, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xc0, 0x80, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0x40, 0x03, 0x80, 0x0e, 0x00,
+    0x70, 0x00, 0x80, 0x00, 0x78, 0x84, 0x04, 0x04, 0x0c, 0x18, 0x30, 0x20, 0x20, 0x00, 0x20, 0x20,
+    0x0f, 0xc0, 0x18, 0x30, 0x20, 0x18, 0x47, 0xa8, 0xc8, 0x64, 0x90, 0x24, 0x90, 0x24, 0x90, 0x24,
+    0x90, 0x24, 0xc8, 0x68, 0x47, 0xb0, 0x20, 0x00, 0x18, 0x30, 0x07, 0xe0, 0x04, 0x00, 0x04, 0x00,
+    0x0a, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x11, 0x00, 0x20, 0x80, 0x20, 0x80, 0x3f, 0x80, 0x40, 0x40,
+    0x40, 0x40, 0x80, 0x20, 0xfe, 0x00, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0xff, 0x00,
+    0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x00, 0xfe, 0x00, 0x1f, 0x00, 0x21, 0x80,
+    0x40, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x00,
+    0x21, 0x80, 0x1f, 0x00, 0xfe, 0x00, 0x83, 0x00, 0x80, 0x80, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40,
+    0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x80, 0x83, 0x00, 0xfe, 0x00, 0xff, 0x80, 0x80, 0x80,
+    0x80, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x1f, 0x80, 0x20, 0xc0, 0x40, 0x40, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x83, 0xc0, 0x80, 0x40, 0x80, 0x40, 0x40, 0x40, 0x20, 0x40, 0x1f, 0x80, 0x80, 0x40, 0x80, 0x40,
+    0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0xff, 0xc0, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40,
+    0x80, 0x40, 0x80, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x81,
+    0x00, 0x82, 0x00, 0x84, 0x00, 0x88, 0x00, 0x90, 0x00, 0xe0, 0x00, 0xa0, 0x00, 0x90, 0x00, 0x88,
+    0x00, 0x84, 0x00, 0x82, 0x00, 0x81, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xfe, 0xc0, 0x60, 0xc0, 0x60, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x91, 0x20, 0x91,
+    0x20, 0x8a, 0x20, 0x8a, 0x20, 0x84, 0x20, 0x80, 0x20, 0x80, 0x20, 0xc0, 0x40, 0xa0, 0x40, 0xa0,
+    0x40, 0x90, 0x40, 0x88, 0x40, 0x88, 0x40, 0x84, 0x40, 0x82, 0x40, 0x82, 0x40, 0x81, 0x40, 0x81,
+    0x40, 0x80, 0xc0, 0x1f, 0x00, 0x20, 0x80, 0x40, 0x40, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80,
+    0x20, 0x80, 0x20, 0x80, 0x20, 0x40, 0x40, 0x20, 0x80, 0x1f, 0x00, 0xfc, 0x82, 0x81, 0x81, 0x81,
+    0x82, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1f, 0x00, 0x20, 0x80, 0x40, 0x40, 0x80, 0x20, 0x80,
+    0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x40, 0x40, 0x20, 0xc0, 0x1f, 0x00, 0x00,
+    0x80, 0x00, 0x40, 0xfc, 0x00, 0x82, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x82, 0x00, 0xfe,
+    0x00, 0x82, 0x00, 0x81, 0x00, 0x81, 0x00, 0x80, 0x80, 0x80, 0x80, 0x3c, 0xc6, 0x80, 0x80, 0x80,
+    0x70, 0x1e, 0x03, 0x01, 0x81, 0xc3, 0x7c, 0xff, 0x80, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x80,
+    0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80,
+    0x40, 0x80, 0x40, 0x40, 0x80, 0x3f, 0x00, 0x80, 0x20, 0x80, 0x20, 0x40, 0x40, 0x40, 0x40, 0x20,
+    0x80, 0x20, 0x80, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x81,
+    0x02, 0x81, 0x02, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x88, 0x24, 0x48, 0x24, 0x48, 0x14,
+    0x50, 0x14, 0x50, 0x08, 0x20, 0x08, 0x20, 0xc1, 0x80, 0x41, 0x00, 0x22, 0x00, 0x22, 0x00, 0x14,
+    0x00, 0x08, 0x00, 0x08, 0x00, 0x14, 0x00, 0x22, 0x00, 0x22, 0x00, 0x41, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x41, 0x00, 0x22, 0x00, 0x22, 0x00, 0x14, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xff, 0xc0, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x02,
+    0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x00, 0xff, 0xc0, 0xe0,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xe0, 0x80, 0xc0, 0x40,
+    0x40, 0x40, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x08, 0x08, 0xe0, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x0c, 0x00, 0x1e, 0x00, 0x21, 0x00, 0x40, 0x80,
+    0xff, 0xc0, 0x60, 0x30, 0x3c, 0x46, 0x02, 0x7e, 0xc2, 0x82, 0x82, 0xc6, 0x7a, 0x80, 0x80, 0x80,
+    0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81, 0x81, 0xc2, 0xbc, 0x3c, 0x42, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x42, 0x3c, 0x01, 0x01, 0x01, 0x3d, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3d, 0x38, 0x44,
+    0x82, 0x82, 0xfe, 0x80, 0x80, 0x42, 0x3c, 0x38, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x3d, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3d, 0x01, 0x42, 0x3c, 0x80,
+    0x80, 0x80, 0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x80, 0x80, 0x80, 0x82, 0x84, 0x88, 0x90, 0xe0, 0x90, 0x88,
+    0x84, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xbc, 0xf0,
+    0xc7, 0x18, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08,
+    0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x3c, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x42, 0x3c, 0xbc, 0xc2, 0x81, 0x81, 0x81, 0x81, 0x81, 0xc2, 0xbc, 0x80, 0x80, 0x80, 0x3d, 0x43,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3d, 0x01, 0x01, 0x01, 0xb8, 0xc0, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x7c, 0x82, 0x80, 0xc0, 0x78, 0x06, 0x02, 0x82, 0x7c, 0x40, 0x40, 0xf8, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x38, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3d,
+    0x80, 0x80, 0x80, 0x80, 0x41, 0x00, 0x41, 0x00, 0x22, 0x00, 0x22, 0x00, 0x14, 0x00, 0x1c, 0x00,
+    0x08, 0x00, 0x82, 0x08, 0x82, 0x08, 0x45, 0x10, 0x45, 0x10, 0x48, 0x90, 0x28, 0xa0, 0x28, 0xa0,
+    0x10, 0x40, 0x10, 0x40, 0xc3, 0x42, 0x24, 0x24, 0x18, 0x24, 0x24, 0x42, 0xc3, 0x80, 0x80, 0x41,
+    0x00, 0x41, 0x00, 0x21, 0x00, 0x22, 0x00, 0x22, 0x00, 0x14, 0x00, 0x14, 0x00, 0x0c, 0x00, 0x08,
+    0x00, 0x08, 0x00, 0x70, 0x00, 0xfe, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0xfe, 0x18, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x18, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x18, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x78, 0x40, 0x87, 0x80,
+};
+
+static const FONT_Kern font_sans16_kern[97] = {
+    {  45,  74,  1 }, {  45,  84, -1 }, {  45,  86, -1 }, {  45,  88, -1 }, {  45,  89, -1 }, {  65,  84, -1 },
+    {  65,  86, -1 }, {  65,  87, -1 }, {  65,  89, -1 }, {  65, 118, -1 }, {  65, 121, -1 }, {  66,  89, -1 },
+    {  68,  89, -1 }, {  70,  46, -2 }, {  70,  58, -1 }, {  70,  65, -1 }, {  70,  97, -1 }, {  70, 101, -1 },
+    {  70, 105, -1 }, {  70, 114, -1 }, {  70, 117, -1 }, {  70, 121, -1 }, {  71,  89, -1 }, {  75,  45, -1 },
+    {  75,  67, -1 }, {  75,  79, -1 }, {  75,  84, -1 }, {  75, 101, -1 }, {  75, 111, -1 }, {  75, 117, -1 },
+    {  75, 121, -1 }, {  76,  84, -1 }, {  76,  85, -1 }, {  76,  86, -1 }, {  76,  87, -1 }, {  76,  89, -1 },
+    {  76, 121, -1 }, {  79,  88, -1 }, {  79,  89, -1 }, {  80,  46, -2 }, {  80,  65, -1 }, {  82,  67, -1 },
+    {  82,  84, -1 }, {  82,  86, -1 }, {  82,  89, -1 }, {  82, 121, -1 }, {  84,  45, -1 }, {  84,  46, -1 },
+    {  84,  58, -1 }, {  84,  65, -1 }, {  84,  67, -1 }, {  84,  97, -2 }, {  84,  99, -2 }, {  84, 101, -2 },
+    {  84, 111, -2 }, {  84, 114, -2 }, {  84, 115, -2 }, {  84, 117, -2 }, {  84, 119, -2 }, {  84, 121, -2 },
+    {  86,  45, -1 }, {  86,  46, -1 }, {  86,  58, -1 }, {  86,  65, -1 }, {  86,  97, -1 }, {  86, 101, -1 },
+    {  86, 111, -1 }, {  86, 117, -1 }, {  87,  46, -1 }, {  87,  58, -1 }, {  87,  65, -1 }, {  87,  97, -1 },
+    {  87, 101, -1 }, {  87, 111, -1 }, {  88,  45, -1 }, {  88,  67, -1 }, {  88,  79, -1 }, {  89,  45, -1 },
+    {  89,  46, -2 }, {  89,  58, -1 }, {  89,  65, -1 }, {  89,  67, -1 }, {  89,  79, -1 }, {  89,  97, -1 },
+    {  89, 101, -1 }, {  89, 111, -1 }, {  89, 117, -1 }, { 102,  45, -1 }, { 102,  46, -1 }, { 114,  45, -1 },
+    { 114,  46, -1 }, { 118,  46, -1 }, { 118,  58, -1 }, { 119,  46, -1 }, { 119,  58, -1 }, { 121,  46, -1 },
+    { 121,  58, -1 },
+};
+
+extern const FONT_Font font_sans16;
+
+const FONT_Font font_sans16 = { 19, 32, 126, 1, 97, font_sans16_glyph, font_sans16_data, font_sans16_kern };
@@ -0,0 +1,416 @@
+/* Generato da Host/font2c.cpp: DejaVu Sans Book, 16 pixel
+ *   font2c -b 4 DejaVuSans.ttf 16 font_sans16_aa "32-126"
+ * riga di 19 pixel, 4 bit per pixel, 4583 byte di bitmap, 97 coppie di kerning */
+#include "font.h"
+
+static const FONT_Glyph font_sans16_aa_glyph[95] = {
+    {     0,   0,   0,    0,   15,   5 },   /* ' ' */
+    {     0,   2,  12,    2,    3,   6 },   /* '!' */
+    {    12,   5,   5,    1,    3,   7 },   /* '"' */
+    {    27,  12,  12,    1,    3,  13 },   /* '#' */
+    {    99,   8,  15,    1,    3,  10 },   /* '$' */
+    {   159,  15,  12,    0,    3,  15 },   /* '%' */
+    {   255,  11,  12,    1,    3,  12 },   /* '&' */
+    {   327,   2,   5,    1,    3,   4 },   /* '\'' */
+    {   332,   4,  15,    1,    3,   6 },   /* '(' */
+    {   362,   4,  15,    1,    3,   6 },   /* ')' */
+    {   392,   8,   8,    0,    3,   8 },   /* '*' */
+    {   424,  11,  11,    1,    4,  13 },   /* '+' */
+    {   490,   3,   4,    1,   13,   5 },   /* ',' */
+    {   498,   5,   3,    0,    9,   6 },   /* '-' */
+    {   507,   3,   2,    1,   13,   5 },   /* '.' */
+    {   511,   6,  13,    0,    3,   5 },   /* '/' */
+    {   550,   9,  12,    1,    3,  10 },   /* '0' */
+    {   610,   8,  12,    1,    3,  10 },   /* '1' */
+    {   658,   8,  12,    1,    3,  10 },   /* '2' */
+    {   706,   8,  12,    1,    3,  10 },   /* '3' */
+    {   754,  10,  12,    0,    3,  10 },   /* '4' */
+    {   814,   8,  12,    1,    3,  10 },   /* '5' */
+    {   862,   9,  12,    1,    3,  10 },   /* '6' */
+    {   922,   8,  12,    1,    3,  10 },   /* '7' */
+    {   970,   9,  12,    1,    3,  10 },   /* '8' */
+    {  1030,   9,  12,    1,    3,  10 },   /* '9' */
+    {  1090,   3,   8,    1,    7,   5 },   /* ':' */
+    {  1106,   3,  10,    1,    7,   5 },   /* ';' */
+    {  1126,  11,  10,    1,    5,  13 },   /* '<' */
+    {  1186,  11,   6,    1,    7,  13 },   /* '=' */
+    {  1222,  11,  10,    1,    5,  13 },   /* '>' */
+    {  1282,   7,  12,    1,    3,   9 },   /* '?' */
+    {  1330,  14,  15,    1,    4,  16 },   /* '@' */
+    {  1435,  11,  12,    0,    3,  11 },   /* 'A' */
+    {  1507,   9,  12,    1,    3,  11 },   /* 'B' */
+    {  1567,  11,  12,    0,    3,  11 },   /* 'C' */
+    {  1639,  11,  12,    1,    3,  12 },   /* 'D' */
+    {  1711,   9,  12,    1,    3,  10 },   /* 'E' */
+    {  1771,   8,  12,    1,    3,   9 },   /* 'F' */
+    {  1819,  12,  12,    0,    3,  12 },   /* 'G' */
+    {  1891,  10,  12,    1,    3,  12 },   /* 'H' */
+    {  1951,   3,  12,    1,    3,   5 },   /* 'I' */
+    {  1975,   5,  15,   -1,    3,   5 },   /* 'J' */
+    {  2020,  10,  12,    1,    3,  11 },   /* 'K' */
+    {  2080,   8,  12,    1,    3,   9 },   /* 'L' */
+    {  2128,  12,  12,    1,    3,  14 },   /* 'M' */
+    {  2200,  10,  12,    1,    3,  12 },   /* 'N' */
+    {  2260,  12,  12,    0,    3,  13 },   /* 'O' */
+    {  2332,   9,  12,    1,    3,  10 },   /* 'P' */
+    {  2392,  12,  14,    0,    3,  13 },   /* 'Q' */
+    {  2476,  10,  12,    1,    3,  11 },   /* 'R' */
+    {  2536,   9,  12,    1,    3,  10 },   /* 'S' */
+    {  2596,  11,  12,   -1,    3,  10 },   /* 'T' */
+    {  2668,  10,  12,    1,    3,  12 },   /* 'U' */
+    {  2728,  11,  12,    0,    3,  11 },   /* 'V' */
+    {  2800,  16,  12,    0,    3,  16 },   /* 'W' */
+    {  2896,  11,  12,    0,    3,  11 },   /* 'X' */
+    {  2968,  11,  12,   -1,    3,  10 },   /* 'Y' */
+    {  3040,  11,  12,    0,    3,  11 },   /* 'Z' */
+    {  3112,   4,  15,    1,    3,   6 },   /* '[' */
+    {  3142,   6,  13,    0,    3,   5 },   /* '\\' */
+    {  3181,   4,  15,    1,    3,   6 },   /* ']' */
+    {  3211,  11,   5,    1,    3,  13 },   /* '^' */
+    {  3241,  10,   2,   -1,   18,   8 },   /* '_' */
+    {  3251,   5,   3,    1,    2,   8 },   /* '`' */
+    {  3260,   9,   9,    0,    6,  10 },   /* 'a' */
+    {  3305,   9,  12,    1,    3,  10 },   /* 'b' */
+    {  3365,   8,   9,    0,    6,   9 },   /* 'c' */
+    {  3401,   9,  12,    0,    3,  10 },   /* 'd' */
+    {  3461,   9,   9,    0,    6,  10 },   /* 'e' */
+    {  3506,   6,  12,    0,    3,   6 },   /* 'f' */
+    {  3542,   9,  12,    0,    6,  10 },   /* 'g' */
+    {  3602,   8,  12,    1,    3,  10 },   /* 'h' */
+    {  3650,   2,  12,    1,    3,   4 },   /* 'i' */
+    {  3662,   4,  15,   -1,    3,   4 },   /* 'j' */
+    {  3692,   9,  12,    1,    3,   9 },   /* 'k' */
+    {  3752,   2,  12,    1,    3,   4 },   /* 'l' */
+    {  3764,  14,   9,    1,    6,  16 },   /* 'm' */
+    {  3827,   8,   9,    1,    6,  10 },   /* 'n' */
+    {  3863,   9,   9,    0,    6,  10 },   /* 'o' */
+    {  3908,   9,  12,    1,    6,  10 },   /* 'p' */
+    {  3968,   9,  12,    0,    6,  10 },   /* 'q' */
+    {  4028,   6,  10,    1,    5,   7 },   /* 'r' */
+    {  4058,   8,   9,    0,    6,   8 },   /* 's' */
+    {  4094,   6,  12,    0,    3,   6 },   /* 't' */
+    {  4130,   8,   9,    1,    6,  10 },   /* 'u' */
+    {  4166,   9,   9,    0,    6,   9 },   /* 'v' */
+    {  4211,  13,   9,    0,    6,  13 },   /* 'w' */
+    {  4274,   9,   9,    0,    6,   9 },   /* 'x' */
+    {  4319,   9,  12,    0,    6,   9 },   /* 'y' */
+    {  4379,   8,   9,    0,    6,   8 },   /* 'z' */
+    {  4415,   7,  16,    2,    3,  10 },   /* '{' */
+    {  4479,   2,  16,    2,    3,   5 },   /* '|' */
+    {  4495,   7,  16,    2,    3,  10 },   /* '}' */
+    {  4559,  11,   4,    1,    8,  13 },   /* '~' */
+};
+
+static const uint8_t font_sans16_aa_data[4583] = {
+    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x8f, 0x8e, 0x6c, 0x00, 0x00, 0x9f, 0x9f, 0x7d, 0x08, 0xc0, 0x7d,
+    0x08, 0xc0, 0x7d, 0x08, 0xc0, 0x7d, 0x08, 0xc0, 0x25, 0x03, 0x40, 0x00, 0x00, 0x5e, 0x00, 0xc7,
+    0x00, 0x00, 0x00, 0x8b, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xb8, 0x03, 0xf1, 0x00, 0x00, 0x00, 0xe5,
+    0x06, 0xd0, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x02, 0x38, 0xd3, 0x3e, 0x73, 0x31, 0x00,
+    0x0a, 0x90, 0x2f, 0x20, 0x00, 0x00, 0x0e, 0x50, 0x5e, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0x23, 0x8d, 0x33, 0xe7, 0x33, 0x10, 0x00, 0xa9, 0x02, 0xf2, 0x00, 0x00, 0x00, 0xe4, 0x06,
+    0xc0, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x06, 0x60, 0x00, 0x05, 0xce, 0xed, 0xa1, 0x5f,
+    0x77, 0x84, 0x82, 0x9c, 0x06, 0x60, 0x00, 0x8e, 0x36, 0x60, 0x00, 0x1c, 0xfe, 0xc6, 0x10, 0x00,
+    0x39, 0xce, 0xe3, 0x00, 0x06, 0x61, 0xdb, 0x00, 0x06, 0x60, 0xac, 0x98, 0x47, 0x87, 0xf7, 0x4a,
+    0xdf, 0xfd, 0x70, 0x00, 0x06, 0x60, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x03, 0x30, 0x00, 0x02,
+    0xbe, 0xc3, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x0c, 0x91, 0x7d, 0x10, 0x04, 0xe1, 0x00, 0x00, 0x1f,
+    0x30, 0x1f, 0x30, 0x0d, 0x50, 0x00, 0x00, 0x1f, 0x30, 0x1f, 0x30, 0x8b, 0x00, 0x00, 0x00, 0x0c,
+    0x91, 0x7d, 0x12, 0xe2, 0x00, 0x00, 0x00, 0x02, 0xbe, 0xc3, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5d, 0x12, 0xbe, 0xc4, 0x00, 0x00, 0x00, 0x01, 0xd5, 0x0b, 0xa1, 0x6e, 0x10, 0x00,
+    0x00, 0x08, 0xb0, 0x0f, 0x40, 0x0f, 0x40, 0x00, 0x00, 0x3e, 0x20, 0x0f, 0x40, 0x0f, 0x40, 0x00,
+    0x00, 0xb7, 0x00, 0x0b, 0xa1, 0x7e, 0x10, 0x00, 0x06, 0xd0, 0x00, 0x02, 0xbe, 0xc4, 0x00, 0x00,
+    0x6d, 0xfd, 0x91, 0x00, 0x00, 0x04, 0xf9, 0x46, 0xb2, 0x00, 0x00, 0x09, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xef, 0xa0,
+    0x00, 0x04, 0x20, 0x7f, 0x35, 0xfa, 0x00, 0x2f, 0x40, 0xda, 0x00, 0x5f, 0x90, 0x6f, 0x10, 0xe9,
+    0x00, 0x06, 0xf9, 0xd9, 0x00, 0xbd, 0x00, 0x00, 0x6f, 0xe1, 0x00, 0x3f, 0xb3, 0x13, 0xaf, 0xf8,
+    0x00, 0x03, 0xae, 0xfd, 0x92, 0x7f, 0x70, 0x7d, 0x7d, 0x7d, 0x7d, 0x25, 0x00, 0x8b, 0x02, 0xf3,
+    0x09, 0xc0, 0x0e, 0x70, 0x4f, 0x30, 0x7f, 0x10, 0x9e, 0x00, 0x9e, 0x00, 0x8f, 0x00, 0x6f, 0x20,
+    0x2f, 0x50, 0x0c, 0x90, 0x05, 0xe1, 0x00, 0xc7, 0x00, 0x36, 0x7c, 0x00, 0x1e, 0x50, 0x09, 0xc0,
+    0x03, 0xf3, 0x00, 0xf7, 0x00, 0xcb, 0x00, 0xbc, 0x00, 0xad, 0x00, 0xbc, 0x00, 0xd9, 0x01, 0xf5,
+    0x06, 0xe1, 0x0b, 0x90, 0x3f, 0x20, 0x45, 0x00, 0x00, 0x07, 0x70, 0x00, 0x24, 0x07, 0x70, 0x43,
+    0x2a, 0xa8, 0x9a, 0xa2, 0x00, 0x4e, 0xe4, 0x00, 0x05, 0xcb, 0xbc, 0x60, 0x49, 0x17, 0x71, 0x95,
+    0x00, 0x07, 0x70, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x50, 0x00, 0x00,
+    0x01, 0x11, 0x1e, 0x61, 0x11, 0x10, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x14, 0x44, 0x4f, 0x84,
+    0x44, 0x30, 0x00, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x2d, 0x70, 0x2f, 0x70, 0x6e, 0x10,
+    0xa8, 0x00, 0x01, 0x11, 0x10, 0x3f, 0xff, 0xf0, 0x14, 0x44, 0x40, 0x4f, 0x50, 0x4f, 0x50, 0x00,
+    0x01, 0xf3, 0x00, 0x06, 0xe0, 0x00, 0x0b, 0x90, 0x00, 0x1f, 0x40, 0x00, 0x5e, 0x00, 0x00, 0xaa,
+    0x00, 0x00, 0xe5, 0x00, 0x04, 0xf1, 0x00, 0x09, 0xb0, 0x00, 0x0e, 0x60, 0x00, 0x3f, 0x20, 0x00,
+    0x8c, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x01, 0xae, 0xeb, 0x20, 0x00, 0x0c, 0xe6, 0x5c, 0xe1, 0x00,
+    0x6f, 0x40, 0x02, 0xf8, 0x00, 0xad, 0x00, 0x00, 0xbd, 0x00, 0xdb, 0x00, 0x00, 0x8f, 0x10, 0xea,
+    0x00, 0x00, 0x7f, 0x10, 0xea, 0x00, 0x00, 0x7f, 0x10, 0xdb, 0x00, 0x00, 0x8f, 0x10, 0xad, 0x00,
+    0x00, 0xbd, 0x00, 0x6f, 0x40, 0x02, 0xf8, 0x00, 0x0c, 0xd6, 0x5c, 0xe1, 0x00, 0x01, 0xae, 0xeb,
+    0x20, 0x00, 0x29, 0xcf, 0xf2, 0x00, 0x4e, 0xbb, 0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07,
+    0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07,
+    0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x05, 0x59, 0xf6, 0x53, 0x0f, 0xff,
+    0xff, 0xfb, 0x49, 0xde, 0xd9, 0x10, 0xbc, 0x76, 0x8e, 0xd1, 0x20, 0x00, 0x05, 0xf6, 0x00, 0x00,
+    0x02, 0xf7, 0x00, 0x00, 0x05, 0xf5, 0x00, 0x00, 0x1d, 0xc0, 0x00, 0x01, 0xbe, 0x20, 0x00, 0x0b,
+    0xe3, 0x00, 0x00, 0xbe, 0x30, 0x00, 0x0a, 0xe4, 0x00, 0x00, 0x9f, 0x95, 0x55, 0x53, 0xcf, 0xff,
+    0xff, 0xf9, 0x3b, 0xdf, 0xea, 0x30, 0x5a, 0x76, 0x7d, 0xf3, 0x00, 0x00, 0x02, 0xf8, 0x00, 0x00,
+    0x00, 0xf8, 0x00, 0x11, 0x2a, 0xe2, 0x00, 0xcf, 0xfe, 0x30, 0x00, 0x34, 0x5c, 0xe3, 0x00, 0x00,
+    0x01, 0xdb, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x01, 0xeb, 0xb9, 0x66, 0x8d, 0xf4, 0x6c, 0xef,
+    0xda, 0x30, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x5e, 0xf9, 0x00, 0x00, 0x01, 0xd6, 0xe9,
+    0x00, 0x00, 0x08, 0xc0, 0xe9, 0x00, 0x00, 0x3f, 0x30, 0xe9, 0x00, 0x00, 0xc8, 0x00, 0xe9, 0x00,
+    0x07, 0xd1, 0x00, 0xe9, 0x00, 0x1e, 0x61, 0x11, 0xea, 0x10, 0x3f, 0xff, 0xff, 0xff, 0xf4, 0x14,
+    0x44, 0x44, 0xfb, 0x41, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x4f, 0xff,
+    0xff, 0xe0, 0x4f, 0x75, 0x55, 0x50, 0x4f, 0x30, 0x00, 0x00, 0x4f, 0x31, 0x00, 0x00, 0x4f, 0xef,
+    0xea, 0x20, 0x39, 0x54, 0x7e, 0xe1, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00,
+    0x00, 0xdb, 0x00, 0x00, 0x04, 0xf8, 0xb9, 0x76, 0x9f, 0xd1, 0x7c, 0xef, 0xd9, 0x10, 0x00, 0x4b,
+    0xee, 0xc4, 0x00, 0x06, 0xfb, 0x76, 0x95, 0x00, 0x2f, 0x80, 0x00, 0x00, 0x00, 0x8f, 0x10, 0x00,
+    0x00, 0x00, 0xbc, 0x6d, 0xfd, 0x70, 0x00, 0xde, 0xe6, 0x49, 0xf7, 0x00, 0xdf, 0x50, 0x00, 0xbe,
+    0x00, 0xcf, 0x10, 0x00, 0x7f, 0x20, 0x9f, 0x10, 0x00, 0x7f, 0x20, 0x4f, 0x50, 0x00, 0xce, 0x00,
+    0x0b, 0xe7, 0x5a, 0xf6, 0x00, 0x01, 0x9e, 0xfc, 0x60, 0x00, 0xaf, 0xff, 0xff, 0xfc, 0x35, 0x55,
+    0x57, 0xf8, 0x00, 0x00, 0x08, 0xf2, 0x00, 0x00, 0x0d, 0xb0, 0x00, 0x00, 0x4f, 0x60, 0x00, 0x00,
+    0xae, 0x10, 0x00, 0x01, 0xea, 0x00, 0x00, 0x06, 0xf4, 0x00, 0x00, 0x0b, 0xd0, 0x00, 0x00, 0x2f,
+    0x80, 0x00, 0x00, 0x8f, 0x20, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x04, 0xbe, 0xec, 0x50, 0x00, 0x3f,
+    0xc5, 0x5a, 0xf5, 0x00, 0x8f, 0x10, 0x00, 0xdb, 0x00, 0x8f, 0x00, 0x00, 0xcb, 0x00, 0x3e, 0x92,
+    0x17, 0xf4, 0x00, 0x03, 0xdf, 0xfe, 0x50, 0x00, 0x2d, 0xb5, 0x49, 0xf5, 0x00, 0xad, 0x00, 0x00,
+    0xbd, 0x00, 0xdb, 0x00, 0x00, 0x8f, 0x10, 0xcd, 0x00, 0x00, 0xbe, 0x00, 0x5f, 0xb5, 0x5a, 0xf8,
+    0x00, 0x05, 0xbe, 0xec, 0x60, 0x00, 0x04, 0xbe, 0xea, 0x20, 0x00, 0x3f, 0xc5, 0x6d, 0xd1, 0x00,
+    0xbe, 0x10, 0x03, 0xf7, 0x00, 0xea, 0x00, 0x00, 0xdc, 0x00, 0xea, 0x00, 0x00, 0xde, 0x00, 0xcd,
+    0x00, 0x01, 0xff, 0x10, 0x6f, 0x91, 0x2b, 0xff, 0x00, 0x07, 0xef, 0xfb, 0xae, 0x00, 0x00, 0x13,
+    0x20, 0xda, 0x00, 0x00, 0x00, 0x06, 0xf4, 0x00, 0x39, 0x66, 0xaf, 0x90, 0x00, 0x2b, 0xef, 0xc6,
+    0x00, 0x00, 0x2f, 0x80, 0x2f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x80,
+    0x2f, 0x80, 0x2f, 0x80, 0x2f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x70,
+    0x2f, 0x70, 0x6e, 0x10, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02,
+    0x8d, 0xb0, 0x00, 0x00, 0x16, 0xcf, 0xd8, 0x20, 0x00, 0x5b, 0xfe, 0x94, 0x00, 0x00, 0x3e, 0xfa,
+    0x50, 0x00, 0x00, 0x00, 0x3e, 0xfb, 0x61, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xee, 0xa5, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xbf, 0xe9, 0x30, 0x00, 0x00, 0x00, 0x02, 0x7c, 0xb0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x14, 0x44,
+    0x44, 0x44, 0x44, 0x30, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xa5, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xbf, 0xe9, 0x30, 0x00, 0x00, 0x00, 0x02, 0x7c, 0xfd, 0x72, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0xdf, 0x90, 0x00, 0x00, 0x00, 0x39, 0xef, 0x80, 0x00, 0x02, 0x8d, 0xfc, 0x61, 0x00,
+    0x17, 0xcf, 0xd8, 0x20, 0x00, 0x00, 0x4e, 0x94, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4a, 0xee, 0xb3, 0x00, 0xda, 0x56, 0xde, 0x10, 0x20, 0x00, 0x4f, 0x50, 0x00, 0x00,
+    0x6f, 0x40, 0x00, 0x03, 0xea, 0x00, 0x00, 0x2e, 0xb0, 0x00, 0x00, 0xbd, 0x10, 0x00, 0x00, 0xd9,
+    0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0xea,
+    0x00, 0x00, 0x00, 0x01, 0x7b, 0xee, 0xc8, 0x20, 0x00, 0x00, 0x4e, 0xc6, 0x43, 0x5a, 0xe6, 0x00,
+    0x04, 0xe6, 0x00, 0x00, 0x00, 0x3e, 0x60, 0x1e, 0x60, 0x00, 0x00, 0x00, 0x03, 0xf2, 0x6c, 0x00,
+    0x1a, 0xed, 0x6b, 0x50, 0xa8, 0xb6, 0x00, 0xbc, 0x44, 0xcf, 0x50, 0x6c, 0xd3, 0x02, 0xf3, 0x00,
+    0x2f, 0x50, 0x4d, 0xe3, 0x04, 0xf0, 0x00, 0x0e, 0x50, 0x5c, 0xc5, 0x03, 0xf2, 0x00, 0x1f, 0x50,
+    0xb8, 0x8a, 0x00, 0xca, 0x11, 0xaf, 0x68, 0xd1, 0x2e, 0x30, 0x2d, 0xff, 0x9c, 0xfa, 0x20, 0x06,
+    0xe3, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x7e, 0x83, 0x00, 0x26, 0xd4, 0x00, 0x00, 0x03, 0xae,
+    0xff, 0xfb, 0x50, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x00,
+    0x00, 0x00, 0x01, 0xef, 0xe0, 0x00, 0x00, 0x00, 0x05, 0xfb, 0xf4, 0x00, 0x00, 0x00, 0x0b, 0xe1,
+    0xea, 0x00, 0x00, 0x00, 0x2f, 0x90, 0xaf, 0x10, 0x00, 0x00, 0x7f, 0x30, 0x4f, 0x60, 0x00, 0x00,
+    0xdd, 0x00, 0x0d, 0xc0, 0x00, 0x03, 0xf8, 0x11, 0x19, 0xf2, 0x00, 0x09, 0xff, 0xff, 0xff, 0xf8,
+    0x00, 0x0e, 0xc4, 0x44, 0x44, 0xcd, 0x00, 0x5f, 0x60, 0x00, 0x00, 0x6f, 0x40, 0xae, 0x10, 0x00,
+    0x00, 0x1e, 0x90, 0x6f, 0xff, 0xfd, 0xa2, 0x00, 0x6f, 0x64, 0x57, 0xed, 0x10, 0x6f, 0x20, 0x00,
+    0x5f, 0x40, 0x6f, 0x20, 0x00, 0x4f, 0x40, 0x6f, 0x31, 0x13, 0xcd, 0x10, 0x6f, 0xff, 0xff, 0xd3,
+    0x00, 0x6f, 0x54, 0x45, 0xce, 0x20, 0x6f, 0x20, 0x00, 0x1e, 0x90, 0x6f, 0x20, 0x00, 0x0d, 0xc0,
+    0x6f, 0x20, 0x00, 0x1f, 0xb0, 0x6f, 0x64, 0x56, 0xcf, 0x50, 0x6f, 0xff, 0xfe, 0xb4, 0x00, 0x00,
+    0x03, 0xae, 0xfe, 0xb5, 0x00, 0x00, 0x6f, 0xc7, 0x56, 0xaf, 0x40, 0x03, 0xfa, 0x00, 0x00, 0x03,
+    0x30, 0x0a, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0xe1, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x03, 0x30, 0x00, 0x6f, 0xc7, 0x56, 0xaf,
+    0x40, 0x00, 0x03, 0xae, 0xfe, 0xb5, 0x00, 0x6f, 0xff, 0xed, 0xa5, 0x00, 0x00, 0x6f, 0x64, 0x57,
+    0xbf, 0xb0, 0x00, 0x6f, 0x20, 0x00, 0x06, 0xf9, 0x00, 0x6f, 0x20, 0x00, 0x00, 0xbf, 0x10, 0x6f,
+    0x20, 0x00, 0x00, 0x6f, 0x40, 0x6f, 0x20, 0x00, 0x00, 0x5f, 0x50, 0x6f, 0x20, 0x00, 0x00, 0x5f,
+    0x50, 0x6f, 0x20, 0x00, 0x00, 0x7f, 0x40, 0x6f, 0x20, 0x00, 0x00, 0xbf, 0x10, 0x6f, 0x20, 0x00,
+    0x06, 0xf8, 0x00, 0x6f, 0x64, 0x57, 0xbf, 0xb0, 0x00, 0x6f, 0xff, 0xed, 0xa5, 0x00, 0x00, 0x6f,
+    0xff, 0xff, 0xfe, 0x00, 0x6f, 0x65, 0x55, 0x55, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x20,
+    0x00, 0x00, 0x00, 0x6f, 0x31, 0x11, 0x11, 0x00, 0x6f, 0xff, 0xff, 0xfb, 0x00, 0x6f, 0x64, 0x44,
+    0x43, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00,
+    0x00, 0x6f, 0x65, 0x55, 0x55, 0x00, 0x6f, 0xff, 0xff, 0xff, 0x10, 0x6f, 0xff, 0xff, 0xf4, 0x6f,
+    0x65, 0x55, 0x51, 0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x6f, 0x31, 0x11, 0x10, 0x6f,
+    0xff, 0xff, 0xc0, 0x6f, 0x64, 0x44, 0x30, 0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x6f,
+    0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x03, 0xad, 0xfe, 0xc8,
+    0x10, 0x00, 0x6f, 0xd7, 0x56, 0x9e, 0xc0, 0x03, 0xfa, 0x00, 0x00, 0x01, 0x70, 0x0a, 0xe1, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x90, 0x00, 0x01, 0x11, 0x10, 0x1f,
+    0x90, 0x00, 0x1f, 0xff, 0xf1, 0x0e, 0xb0, 0x00, 0x04, 0x49, 0xf1, 0x0a, 0xe1, 0x00, 0x00, 0x07,
+    0xf1, 0x04, 0xfa, 0x00, 0x00, 0x07, 0xf1, 0x00, 0x7f, 0xd7, 0x55, 0x8d, 0xe1, 0x00, 0x03, 0xad,
+    0xfe, 0xc7, 0x10, 0x6f, 0x20, 0x00, 0x02, 0xf7, 0x6f, 0x20, 0x00, 0x02, 0xf7, 0x6f, 0x20, 0x00,
+    0x02, 0xf7, 0x6f, 0x20, 0x00, 0x02, 0xf7, 0x6f, 0x31, 0x11, 0x12, 0xf7, 0x6f, 0xff, 0xff, 0xff,
+    0xf7, 0x6f, 0x64, 0x44, 0x45, 0xf7, 0x6f, 0x20, 0x00, 0x02, 0xf7, 0x6f, 0x20, 0x00, 0x02, 0xf7,
+    0x6f, 0x20, 0x00, 0x02, 0xf7, 0x6f, 0x20, 0x00, 0x02, 0xf7, 0x6f, 0x20, 0x00, 0x02, 0xf7, 0x6f,
+    0x20, 0x6f, 0x20, 0x6f, 0x20, 0x6f, 0x20, 0x6f, 0x20, 0x6f, 0x20, 0x6f, 0x20, 0x6f, 0x20, 0x6f,
+    0x20, 0x6f, 0x20, 0x6f, 0x20, 0x6f, 0x20, 0x00, 0x6f, 0x20, 0x00, 0x6f, 0x20, 0x00, 0x6f, 0x20,
+    0x00, 0x6f, 0x20, 0x00, 0x6f, 0x20, 0x00, 0x6f, 0x20, 0x00, 0x6f, 0x20, 0x00, 0x6f, 0x20, 0x00,
+    0x6f, 0x20, 0x00, 0x6f, 0x20, 0x00, 0x6f, 0x20, 0x00, 0x7f, 0x20, 0x00, 0xaf, 0x00, 0x48, 0xfa,
+    0x00, 0xcd, 0x91, 0x00, 0x6f, 0x20, 0x00, 0x3e, 0xc1, 0x6f, 0x20, 0x03, 0xec, 0x10, 0x6f, 0x20,
+    0x4e, 0xc1, 0x00, 0x6f, 0x24, 0xeb, 0x10, 0x00, 0x6f, 0x7f, 0xb1, 0x00, 0x00, 0x6f, 0xfd, 0x00,
+    0x00, 0x00, 0x6f, 0xbf, 0x80, 0x00, 0x00, 0x6f, 0x29, 0xf7, 0x00, 0x00, 0x6f, 0x20, 0x9f, 0x70,
+    0x00, 0x6f, 0x20, 0x0a, 0xf6, 0x00, 0x6f, 0x20, 0x00, 0xaf, 0x60, 0x6f, 0x20, 0x00, 0x0b, 0xf5,
+    0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00,
+    0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00,
+    0x6f, 0x20, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x6f, 0x65, 0x55, 0x54, 0x6f, 0xff, 0xff, 0xfc,
+    0x6f, 0xf2, 0x00, 0x00, 0x4f, 0xf4, 0x6f, 0xe7, 0x00, 0x00, 0xae, 0xf4, 0x6f, 0x9d, 0x00, 0x01,
+    0xf9, 0xf4, 0x6f, 0x4f, 0x30, 0x06, 0xe5, 0xf4, 0x6f, 0x2c, 0x90, 0x0b, 0x94, 0xf4, 0x6f, 0x26,
+    0xe0, 0x2f, 0x34, 0xf4, 0x6f, 0x21, 0xf4, 0x7d, 0x04, 0xf4, 0x6f, 0x20, 0xaa, 0xd8, 0x04, 0xf4,
+    0x6f, 0x20, 0x5f, 0xf2, 0x04, 0xf4, 0x6f, 0x20, 0x0a, 0x90, 0x04, 0xf4, 0x6f, 0x20, 0x00, 0x00,
+    0x04, 0xf4, 0x6f, 0x20, 0x00, 0x00, 0x04, 0xf4, 0x6f, 0xe1, 0x00, 0x02, 0xf6, 0x6f, 0xf7, 0x00,
+    0x02, 0xf6, 0x6f, 0xbe, 0x10, 0x02, 0xf6, 0x6f, 0x4f, 0x80, 0x02, 0xf6, 0x6f, 0x29, 0xe1, 0x02,
+    0xf6, 0x6f, 0x22, 0xf8, 0x02, 0xf6, 0x6f, 0x20, 0x8e, 0x12, 0xf6, 0x6f, 0x20, 0x1e, 0x92, 0xf6,
+    0x6f, 0x20, 0x08, 0xf4, 0xf6, 0x6f, 0x20, 0x01, 0xeb, 0xf6, 0x6f, 0x20, 0x00, 0x7f, 0xf6, 0x6f,
+    0x20, 0x00, 0x1e, 0xf6, 0x00, 0x04, 0xbe, 0xfd, 0x81, 0x00, 0x00, 0x7f, 0xc6, 0x58, 0xed, 0x20,
+    0x03, 0xfa, 0x00, 0x00, 0x2e, 0xc0, 0x0a, 0xf1, 0x00, 0x00, 0x07, 0xf4, 0x0e, 0xb0, 0x00, 0x00,
+    0x02, 0xf8, 0x1f, 0x90, 0x00, 0x00, 0x01, 0xfa, 0x1f, 0x90, 0x00, 0x00, 0x01, 0xfa, 0x0e, 0xb0,
+    0x00, 0x00, 0x02, 0xf8, 0x0a, 0xe1, 0x00, 0x00, 0x07, 0xf4, 0x04, 0xfa, 0x00, 0x00, 0x2e, 0xc0,
+    0x00, 0x7f, 0xc6, 0x58, 0xee, 0x20, 0x00, 0x04, 0xbe, 0xfd, 0x91, 0x00, 0x6f, 0xff, 0xec, 0x60,
+    0x00, 0x6f, 0x64, 0x5b, 0xf8, 0x00, 0x6f, 0x20, 0x00, 0xce, 0x00, 0x6f, 0x20, 0x00, 0x9f, 0x10,
+    0x6f, 0x20, 0x00, 0xbf, 0x00, 0x6f, 0x31, 0x27, 0xfa, 0x00, 0x6f, 0xff, 0xff, 0xa1, 0x00, 0x6f,
+    0x54, 0x31, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x20,
+    0x00, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbe, 0xfd, 0x81, 0x00, 0x00, 0x7f,
+    0xc6, 0x58, 0xed, 0x20, 0x03, 0xfa, 0x00, 0x00, 0x2e, 0xc0, 0x0a, 0xf1, 0x00, 0x00, 0x08, 0xf4,
+    0x0e, 0xb0, 0x00, 0x00, 0x02, 0xf8, 0x1f, 0x90, 0x00, 0x00, 0x01, 0xfa, 0x1f, 0x90, 0x00, 0x00,
+    0x01, 0xfa, 0x0e, 0xb0, 0x00, 0x00, 0x02, 0xf8, 0x0a, 0xe1, 0x00, 0x00, 0x07, 0xf4, 0x04, 0xfa,
+    0x00, 0x00, 0x2e, 0xd0, 0x00, 0x7f, 0xc6, 0x57, 0xee, 0x30, 0x00, 0x04, 0xbe, 0xff, 0xc2, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x30, 0x6f, 0xff, 0xfd, 0x80,
+    0x00, 0x6f, 0x64, 0x5a, 0xf8, 0x00, 0x6f, 0x20, 0x00, 0xce, 0x00, 0x6f, 0x20, 0x00, 0x9f, 0x10,
+    0x6f, 0x20, 0x00, 0xbe, 0x00, 0x6f, 0x31, 0x16, 0xf6, 0x00, 0x6f, 0xff, 0xff, 0x80, 0x00, 0x6f,
+    0x54, 0x5b, 0xf5, 0x00, 0x6f, 0x20, 0x01, 0xde, 0x10, 0x6f, 0x20, 0x00, 0x5f, 0x70, 0x6f, 0x20,
+    0x00, 0x0c, 0xd0, 0x6f, 0x20, 0x00, 0x04, 0xf6, 0x04, 0xbe, 0xed, 0xa4, 0x00, 0x6f, 0xb6, 0x57,
+    0xb8, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x72, 0x00, 0x00,
+    0x00, 0x2b, 0xff, 0xd9, 0x40, 0x00, 0x00, 0x37, 0xae, 0xf7, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x10,
+    0x00, 0x00, 0x00, 0x6f, 0x30, 0x20, 0x00, 0x00, 0x9f, 0x20, 0xdc, 0x75, 0x6a, 0xfa, 0x00, 0x5a,
+    0xdf, 0xec, 0x70, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x05, 0x55, 0x5e, 0xc5, 0x55, 0x40,
+    0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x04,
+    0xf5, 0x9f, 0x00, 0x00, 0x04, 0xf5, 0x9f, 0x00, 0x00, 0x04, 0xf5, 0x9f, 0x00, 0x00, 0x04, 0xf5,
+    0x9f, 0x00, 0x00, 0x04, 0xf5, 0x9f, 0x00, 0x00, 0x04, 0xf5, 0x9f, 0x00, 0x00, 0x04, 0xf5, 0x9f,
+    0x00, 0x00, 0x04, 0xf5, 0x8f, 0x20, 0x00, 0x06, 0xf3, 0x4f, 0x70, 0x00, 0x0b, 0xe0, 0x0b, 0xf9,
+    0x56, 0xbf, 0x60, 0x00, 0x8d, 0xfe, 0xc5, 0x00, 0xae, 0x00, 0x00, 0x00, 0x1e, 0x90, 0x5f, 0x50,
+    0x00, 0x00, 0x6f, 0x40, 0x0e, 0xa0, 0x00, 0x00, 0xbd, 0x00, 0x09, 0xf1, 0x00, 0x02, 0xf8, 0x00,
+    0x03, 0xf6, 0x00, 0x07, 0xf2, 0x00, 0x00, 0xdc, 0x00, 0x0d, 0xc0, 0x00, 0x00, 0x7f, 0x20, 0x3f,
+    0x60, 0x00, 0x00, 0x2f, 0x80, 0x9f, 0x10, 0x00, 0x00, 0x0b, 0xd0, 0xea, 0x00, 0x00, 0x00, 0x05,
+    0xf8, 0xf4, 0x00, 0x00, 0x00, 0x01, 0xef, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x00, 0x00,
+    0x5f, 0x40, 0x00, 0x1f, 0xe0, 0x00, 0x06, 0xf3, 0x2f, 0x70, 0x00, 0x5e, 0xf2, 0x00, 0x0a, 0xe0,
+    0x0d, 0xb0, 0x00, 0x9b, 0xd6, 0x00, 0x0e, 0xa0, 0x09, 0xe0, 0x00, 0xc7, 0x9a, 0x00, 0x2f, 0x70,
+    0x06, 0xf3, 0x01, 0xf3, 0x6d, 0x00, 0x6f, 0x30, 0x02, 0xf7, 0x05, 0xe0, 0x2f, 0x20, 0x9e, 0x00,
+    0x00, 0xda, 0x08, 0xb0, 0x0e, 0x60, 0xdb, 0x00, 0x00, 0xae, 0x0c, 0x80, 0x0a, 0x92, 0xf7, 0x00,
+    0x00, 0x6f, 0x3f, 0x40, 0x07, 0xd5, 0xf3, 0x00, 0x00, 0x2f, 0xaf, 0x10, 0x03, 0xfa, 0xe0, 0x00,
+    0x00, 0x0e, 0xfc, 0x00, 0x00, 0xef, 0xb0, 0x00, 0x00, 0x0a, 0xf8, 0x00, 0x00, 0xbf, 0x70, 0x00,
+    0x0a, 0xe1, 0x00, 0x00, 0xcd, 0x10, 0x01, 0xea, 0x00, 0x07, 0xf4, 0x00, 0x00, 0x6f, 0x50, 0x2f,
+    0x90, 0x00, 0x00, 0x0b, 0xe1, 0xbd, 0x10, 0x00, 0x00, 0x02, 0xed, 0xf4, 0x00, 0x00, 0x00, 0x00,
+    0x8f, 0xa0, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xd1, 0x00, 0x00, 0x00, 0x09, 0xe4, 0xf9, 0x00, 0x00,
+    0x00, 0x4f, 0x70, 0x7f, 0x30, 0x00, 0x01, 0xdc, 0x00, 0x0c, 0xd0, 0x00, 0x08, 0xf3, 0x00, 0x03,
+    0xf8, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x8f, 0x30, 0x0b, 0xe1, 0x00, 0x00, 0x3f, 0x70, 0x02, 0xea,
+    0x00, 0x00, 0xdc, 0x00, 0x00, 0x6f, 0x50, 0x08, 0xf3, 0x00, 0x00, 0x0b, 0xe1, 0x3f, 0x80, 0x00,
+    0x00, 0x02, 0xe9, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xb0,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x05, 0x55, 0x55, 0x57, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0c,
+    0xe2, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x40, 0x00, 0x00, 0x00, 0x06, 0xf7, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xdd, 0x10, 0x00, 0x00, 0x00, 0x0b, 0xf3, 0x00, 0x00, 0x00,
+    0x00, 0x7f, 0x60, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xe5, 0x55, 0x55,
+    0x55, 0x10, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x9f, 0xfa, 0x9d, 0x21, 0x9c, 0x00, 0x9c, 0x00,
+    0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00, 0x9c, 0x00,
+    0x9c, 0x00, 0x9f, 0xea, 0x12, 0x21, 0xd7, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x3f, 0x20, 0x00, 0x0e,
+    0x60, 0x00, 0x09, 0xb0, 0x00, 0x04, 0xf1, 0x00, 0x00, 0xe5, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x5e,
+    0x00, 0x00, 0x1f, 0x40, 0x00, 0x0b, 0x90, 0x00, 0x06, 0xe0, 0x00, 0x02, 0xf3, 0x7f, 0xfd, 0x12,
+    0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x00,
+    0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0x9d, 0x6e, 0xfd, 0x12, 0x22, 0x00, 0x00, 0x28, 0x50, 0x00,
+    0x00, 0x00, 0x02, 0xde, 0xf6, 0x00, 0x00, 0x00, 0x1d, 0xd2, 0x8f, 0x50, 0x00, 0x01, 0xcc, 0x10,
+    0x07, 0xf5, 0x00, 0x1c, 0xb1, 0x00, 0x00, 0x6e, 0x40, 0x2f, 0xff, 0xff, 0xff, 0xf2, 0x02, 0x22,
+    0x22, 0x22, 0x20, 0x4f, 0x40, 0x00, 0x06, 0xd1, 0x00, 0x00, 0x8b, 0x00, 0x03, 0xad, 0xfd, 0x91,
+    0x00, 0x04, 0x85, 0x46, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x7c, 0xef, 0xff, 0x50,
+    0x08, 0xe7, 0x32, 0x4f, 0x50, 0x0e, 0x80, 0x00, 0x3f, 0x50, 0x0e, 0x70, 0x00, 0x8f, 0x50, 0x0a,
+    0xd2, 0x16, 0xef, 0x50, 0x01, 0xae, 0xeb, 0x3f, 0x50, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00,
+    0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x3c, 0xfd, 0x70, 0x00, 0x8e, 0xd6, 0x49,
+    0xf6, 0x00, 0x8f, 0x50, 0x00, 0xae, 0x00, 0x8f, 0x00, 0x00, 0x5f, 0x20, 0x8e, 0x00, 0x00, 0x4f,
+    0x40, 0x8f, 0x00, 0x00, 0x5f, 0x20, 0x8f, 0x50, 0x00, 0xae, 0x00, 0x8e, 0xd6, 0x49, 0xf6, 0x00,
+    0x8e, 0x3c, 0xfd, 0x70, 0x00, 0x00, 0x3a, 0xef, 0xd7, 0x03, 0xec, 0x64, 0x69, 0x0b, 0xd1, 0x00,
+    0x00, 0x0f, 0x80, 0x00, 0x00, 0x1f, 0x70, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x0b, 0xe1, 0x00,
+    0x00, 0x03, 0xed, 0x64, 0x69, 0x00, 0x3a, 0xef, 0xd7, 0x00, 0x00, 0x00, 0x0b, 0xb0, 0x00, 0x00,
+    0x00, 0x0b, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0xb0, 0x00, 0x5d, 0xfd, 0x5b, 0xb0, 0x04, 0xfa, 0x45,
+    0xde, 0xb0, 0x0b, 0xd0, 0x00, 0x3f, 0xb0, 0x0f, 0x80, 0x00, 0x0d, 0xb0, 0x1f, 0x60, 0x00, 0x0c,
+    0xb0, 0x0f, 0x70, 0x00, 0x0d, 0xb0, 0x0b, 0xb0, 0x00, 0x2f, 0xb0, 0x04, 0xf7, 0x12, 0xce, 0xb0,
+    0x00, 0x5d, 0xfd, 0x6b, 0xb0, 0x00, 0x3a, 0xef, 0xc4, 0x00, 0x03, 0xec, 0x54, 0xaf, 0x30, 0x0b,
+    0xd1, 0x00, 0x0c, 0xa0, 0x0f, 0x80, 0x00, 0x08, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x92,
+    0x22, 0x22, 0x20, 0x0b, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xec, 0x64, 0x58, 0x80, 0x00, 0x2a, 0xef,
+    0xda, 0x40, 0x00, 0x6d, 0xfe, 0x01, 0xf9, 0x33, 0x03, 0xf3, 0x00, 0x9f, 0xff, 0xf8, 0x15, 0xf4,
+    0x21, 0x04, 0xf3, 0x00, 0x04, 0xf3, 0x00, 0x04, 0xf3, 0x00, 0x04, 0xf3, 0x00, 0x04, 0xf3, 0x00,
+    0x04, 0xf3, 0x00, 0x04, 0xf3, 0x00, 0x00, 0x5d, 0xfc, 0x5b, 0xb0, 0x04, 0xfa, 0x45, 0xde, 0xb0,
+    0x0b, 0xc0, 0x00, 0x3f, 0xb0, 0x0f, 0x70, 0x00, 0x0d, 0xb0, 0x1f, 0x60, 0x00, 0x0b, 0xb0, 0x0f,
+    0x70, 0x00, 0x0d, 0xb0, 0x0b, 0xc0, 0x00, 0x3f, 0xb0, 0x04, 0xfa, 0x45, 0xde, 0xa0, 0x00, 0x5d,
+    0xfd, 0x5c, 0xa0, 0x00, 0x00, 0x00, 0x1e, 0x70, 0x01, 0x95, 0x35, 0xce, 0x10, 0x00, 0xae, 0xfe,
+    0xa2, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8e, 0x3b,
+    0xed, 0x60, 0x8e, 0xd7, 0x49, 0xf4, 0x8f, 0x40, 0x00, 0xda, 0x8f, 0x00, 0x00, 0xab, 0x8e, 0x00,
+    0x00, 0xac, 0x8e, 0x00, 0x00, 0xac, 0x8e, 0x00, 0x00, 0xac, 0x8e, 0x00, 0x00, 0xac, 0x8e, 0x00,
+    0x00, 0xac, 0x7e, 0x6c, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x7e,
+    0x00, 0x6c, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e,
+    0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x8d, 0x14, 0xda, 0x4e, 0xb2, 0x8e, 0x00, 0x00, 0x00,
+    0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x06, 0xf7, 0x00,
+    0x8e, 0x00, 0x7f, 0x60, 0x00, 0x8e, 0x09, 0xe5, 0x00, 0x00, 0x8e, 0xae, 0x40, 0x00, 0x00, 0x8f,
+    0xeb, 0x00, 0x00, 0x00, 0x8e, 0x4e, 0xa0, 0x00, 0x00, 0x8e, 0x04, 0xea, 0x00, 0x00, 0x8e, 0x00,
+    0x3e, 0xa0, 0x00, 0x8e, 0x00, 0x03, 0xea, 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+    0x7e, 0x7e, 0x7e, 0x7e, 0x8e, 0x3c, 0xfd, 0x50, 0x6d, 0xeb, 0x20, 0x8e, 0xd6, 0x5b, 0xf8, 0xc5,
+    0x5e, 0xb0, 0x8f, 0x40, 0x01, 0xfd, 0x10, 0x06, 0xf1, 0x8f, 0x00, 0x00, 0xea, 0x00, 0x04, 0xf3,
+    0x8e, 0x00, 0x00, 0xd8, 0x00, 0x03, 0xf4, 0x8e, 0x00, 0x00, 0xd8, 0x00, 0x03, 0xf4, 0x8e, 0x00,
+    0x00, 0xd8, 0x00, 0x03, 0xf4, 0x8e, 0x00, 0x00, 0xd8, 0x00, 0x03, 0xf4, 0x8e, 0x00, 0x00, 0xd8,
+    0x00, 0x03, 0xf4, 0x8e, 0x4c, 0xfd, 0x60, 0x8f, 0xc4, 0x17, 0xf4, 0x8f, 0x30, 0x00, 0xca, 0x8e,
+    0x00, 0x00, 0xab, 0x8e, 0x00, 0x00, 0xac, 0x8e, 0x00, 0x00, 0xac, 0x8e, 0x00, 0x00, 0xac, 0x8e,
+    0x00, 0x00, 0xac, 0x8e, 0x00, 0x00, 0xac, 0x00, 0x4c, 0xfe, 0xb2, 0x00, 0x04, 0xfb, 0x55, 0xde,
+    0x20, 0x0c, 0xd0, 0x00, 0x2f, 0x90, 0x0f, 0x80, 0x00, 0x0b, 0xd0, 0x1f, 0x70, 0x00, 0x0a, 0xe0,
+    0x0f, 0x80, 0x00, 0x0b, 0xc0, 0x0c, 0xd0, 0x00, 0x2f, 0x90, 0x04, 0xfb, 0x55, 0xde, 0x20, 0x00,
+    0x4c, 0xfe, 0xb2, 0x00, 0x8e, 0x4c, 0xfd, 0x70, 0x00, 0x8f, 0xd3, 0x16, 0xf6, 0x00, 0x8f, 0x40,
+    0x00, 0x9e, 0x00, 0x8f, 0x00, 0x00, 0x5f, 0x20, 0x8e, 0x00, 0x00, 0x4f, 0x40, 0x8f, 0x10, 0x00,
+    0x5f, 0x20, 0x8f, 0x60, 0x00, 0xae, 0x00, 0x8e, 0xd7, 0x49, 0xf6, 0x00, 0x8e, 0x3c, 0xfd, 0x70,
+    0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5d, 0xfd, 0x5b, 0xb0, 0x04, 0xfa, 0x45, 0xde, 0xb0, 0x0b, 0xc0, 0x00, 0x3f, 0xb0, 0x0f,
+    0x70, 0x00, 0x0d, 0xb0, 0x1f, 0x60, 0x00, 0x0c, 0xb0, 0x0f, 0x70, 0x00, 0x0d, 0xb0, 0x0b, 0xc0,
+    0x00, 0x3f, 0xb0, 0x04, 0xfa, 0x46, 0xde, 0xb0, 0x00, 0x5d, 0xfd, 0x5b, 0xb0, 0x00, 0x00, 0x00,
+    0x0b, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0xb0, 0x00, 0x00, 0x00, 0x8e,
+    0x4c, 0xf9, 0x8f, 0xd4, 0x22, 0x8f, 0x40, 0x00, 0x8f, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x8e, 0x00,
+    0x00, 0x8e, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x02, 0xae, 0xfd, 0xa1, 0x0c, 0xc5,
+    0x35, 0x91, 0x0f, 0x60, 0x00, 0x00, 0x0c, 0xd6, 0x30, 0x00, 0x02, 0x9e, 0xfd, 0x70, 0x00, 0x00,
+    0x38, 0xf5, 0x00, 0x00, 0x00, 0xf8, 0x2c, 0x64, 0x49, 0xf4, 0x19, 0xde, 0xec, 0x50, 0x04, 0x70,
+    0x00, 0x08, 0xe0, 0x00, 0x08, 0xe0, 0x00, 0x8f, 0xff, 0xfd, 0x19, 0xe2, 0x22, 0x08, 0xe0, 0x00,
+    0x08, 0xe0, 0x00, 0x08, 0xe0, 0x00, 0x08, 0xe0, 0x00, 0x07, 0xf0, 0x00, 0x05, 0xf7, 0x33, 0x00,
+    0x9e, 0xfd, 0xac, 0x00, 0x00, 0xba, 0xac, 0x00, 0x00, 0xba, 0xac, 0x00, 0x00, 0xba, 0xac, 0x00,
+    0x00, 0xba, 0xac, 0x00, 0x00, 0xba, 0x9c, 0x00, 0x00, 0xca, 0x7e, 0x00, 0x01, 0xea, 0x2f, 0x81,
+    0x3b, 0xea, 0x05, 0xdf, 0xd5, 0xba, 0x5f, 0x30, 0x00, 0x0b, 0xc0, 0x0e, 0x80, 0x00, 0x1f, 0x70,
+    0x09, 0xd0, 0x00, 0x7f, 0x10, 0x04, 0xf4, 0x00, 0xcb, 0x00, 0x00, 0xd9, 0x02, 0xf5, 0x00, 0x00,
+    0x8e, 0x18, 0xe1, 0x00, 0x00, 0x2f, 0x5d, 0x90, 0x00, 0x00, 0x0c, 0xdf, 0x40, 0x00, 0x00, 0x06,
+    0xfd, 0x00, 0x00, 0x3f, 0x40, 0x06, 0xf8, 0x00, 0x2f, 0x40, 0x0e, 0x70, 0x0a, 0xec, 0x00, 0x6f,
+    0x10, 0x0a, 0xb0, 0x0e, 0x8f, 0x10, 0xac, 0x00, 0x07, 0xf0, 0x3f, 0x1e, 0x40, 0xe8, 0x00, 0x03,
+    0xf4, 0x7c, 0x0b, 0x83, 0xf4, 0x00, 0x00, 0xe8, 0xb8, 0x07, 0xc6, 0xf1, 0x00, 0x00, 0xac, 0xe4,
+    0x03, 0xfb, 0xb0, 0x00, 0x00, 0x6f, 0xf1, 0x00, 0xef, 0x80, 0x00, 0x00, 0x2f, 0xc0, 0x00, 0xaf,
+    0x40, 0x00, 0x1d, 0xc0, 0x00, 0x4f, 0x60, 0x03, 0xf8, 0x01, 0xea, 0x00, 0x00, 0x7f, 0x4b, 0xd1,
+    0x00, 0x00, 0x0b, 0xff, 0x40, 0x00, 0x00, 0x05, 0xfc, 0x00, 0x00, 0x00, 0x1e, 0xcf, 0x70, 0x00,
+    0x00, 0xbd, 0x18, 0xf3, 0x00, 0x07, 0xf4, 0x00, 0xcd, 0x10, 0x3f, 0x80, 0x00, 0x2e, 0x90, 0x5f,
+    0x30, 0x00, 0x0b, 0xc0, 0x0d, 0x90, 0x00, 0x2f, 0x60, 0x07, 0xe1, 0x00, 0x8e, 0x10, 0x01, 0xf6,
+    0x00, 0xe9, 0x00, 0x00, 0xac, 0x05, 0xf3, 0x00, 0x00, 0x4f, 0x3b, 0xc0, 0x00, 0x00, 0x0c, 0xbf,
+    0x60, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x06, 0xf2, 0x00,
+    0x00, 0x02, 0x4d, 0xa0, 0x00, 0x00, 0x0b, 0xfb, 0x20, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xfb, 0x02,
+    0x22, 0x26, 0xf8, 0x00, 0x00, 0x2e, 0xb0, 0x00, 0x01, 0xcd, 0x10, 0x00, 0x0a, 0xe2, 0x00, 0x00,
+    0x8f, 0x40, 0x00, 0x05, 0xf6, 0x00, 0x00, 0x2e, 0xb2, 0x22, 0x22, 0x5f, 0xff, 0xff, 0xfb, 0x00,
+    0x09, 0xef, 0x30, 0x00, 0x6f, 0x62, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+    0x8d, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x03, 0xe9, 0x00, 0x00, 0xff, 0xc1, 0x00, 0x00, 0x35,
+    0xe8, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+    0x8e, 0x00, 0x00, 0x00, 0x6f, 0x30, 0x00, 0x00, 0x1c, 0xff, 0x30, 0x00, 0x00, 0x12, 0x00, 0xf5,
+    0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xfe,
+    0xb2, 0x00, 0x00, 0x24, 0xe8, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+    0xab, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x7f, 0x40, 0x00, 0x00, 0x0a, 0xff, 0x30, 0x00,
+    0x5f, 0x73, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+    0xbb, 0x00, 0x00, 0x02, 0xe9, 0x00, 0x00, 0xff, 0xd3, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0xdf, 0xea, 0x52, 0x27, 0xa0, 0x4d, 0x64, 0x6b, 0xff, 0xfc,
+    0x40, 0x10, 0x00, 0x00, 0x13, 0x20, 0x00,
+};
+
+static const FONT_Kern font_sans16_aa_kern[97] = {
+    {  45,  74,  1 }, {  45,  84, -1 }, {  45,  86, -1 }, {  45,  88, -1 }, {  45,  89, -1 }, {  65,  84, -1 },
+    {  65,  86, -1 }, {  65,  87, -1 }, {  65,  89, -1 }, {  65, 118, -1 }, {  65, 121, -1 }, {  66,  89, -1 },
+    {  68,  89, -1 }, {  70,  46, -2 }, {  70,  58, -1 }, {  70,  65, -1 }, {  70,  97, -1 }, {  70, 101, -1 },
+    {  70, 105, -1 }, {  70, 114, -1 }, {  70, 117, -1 }, {  70, 121, -1 }, {  71,  89, -1 }, {  75,  45, -1 },
+    {  75,  67, -1 }, {  75,  79, -1 }, {  75,  84, -1 }, {  75, 101, -1 }, {  75, 111, -1 }, {  75, 117, -1 },
+    {  75, 121, -1 }, {  76,  84, -1 }, {  76,  85, -1 }, {  76,  86, -1 }, {  76,  87, -1 }, {  76,  89, -1 },
+    {  76, 121, -1 }, {  79,  88, -1 }, {  79,  89, -1 }, {  80,  46, -2 }, {  80,  65, -1 }, {  82,  67, -1 },
+    {  82,  84, -1 }, {  82,  86, -1 }, {  82,  89, -1 }, {  82, 121, -1 }, {  84,  45, -1 }, {  84,  46, -1 },
+    {  84,  58, -1 }, {  84,  65, -1 }, {  84,  67, -1 }, {  84,  97, -2 }, {  84,  99, -2 }, {  84, 101, -2 },
+    {  84, 111, -2 }, {  84, 114, -2 }, {  84, 115, -2 }, {  84, 117, -2 }, {  84, 119, -2 }, {  84, 121, -2 },
+    {  86,  45, -1 }, {  86,  46, -1 }, {  86,  58, -1 }, {  86,  65, -1 }, {  86,  97, -1 }, {  86, 101, -1 },
+    {  86, 111, -1 }, {  86, 117, -1 }, {  87,  46, -1 }, {  87,  58, -1 }, {  87,  65, -1 }, {  87,  97, -1 },
+    {  87, 101, -1 }, {  87, 111, -1 }, {  88,  45, -1 }, {  88,  67, -1 }, {  88,  79, -1 }, {  89,  45, -1 },
+    {  89,  46, -2 }, {  89,  58, -1 }, {  89,  65, -1 }, {  89,  67, -1 }, {  89,  79, -1 }, {  89,  97, -1 },
+    {  89, 101, -1 }, {  89, 111, -1 }, {  89, 117, -1 }, { 102,  45, -1 }, { 102,  46, -1 }, { 114,  45, -1 },
+    { 114,  46, -1 }, { 118,  46, -1 }, { 118,  58, -1 }, { 119,  46, -1 }, { 119,  58, -1 }, { 121,  46, -1 },
+    { 121,  58, -1 },
+};
+
+extern const FONT_Font font_sans16_aa;
+
+const FONT_Font font_sans16_aa = { 19, 32, 126, 4, 97, font_sans16_aa_glyph, font_sans16_aa_data, font_sans16_aa_kern };
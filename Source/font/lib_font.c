@@ -0,0 +1,399 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_font.c
+** Descriptions:        Disegno dei font di font.h. font_draw compone ogni riga di pixel della stringa
+** in una maschera di bit (i glifi si possono sovrapporre col kerning) e la scandisce con __CLZ:
+** ogni tratto di bit uguali diventa un solo LCD_PushColor. font_draw_over scandisce le righe dei
+** glifi allo stesso modo e scrive solo i tratti accesi, come span di LCD_FillRect.
+** Con l'antialiasing la riga e' di livelli di copertura (il massimo dove i glifi si sovrappongono)
+** e ogni tratto dello stesso livello e' un LCD_PushColor del colore preso da font_lut.
+** Correlated files:    font.h, font_*.c (generati), Host/font2c.cpp, GLCD.c (LCD_GetClip)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include "font.h"
+
+#define FONT_WORDS          ( ((MAX_X > 256) ? MAX_X : 256) / 32 + 1 )    /* riga di schermo o glifo, + 1 di scarto */
+
+static uint32_t          font_row[FONT_WORDS];          /* bit 31 della parola 0 = prima colonna */
+static int16_t           font_gx[FONT_RUN];             /* colonna della bitmap di ogni glifo raccolto */
+static const FONT_Glyph *font_gg[FONT_RUN];
+static uint8_t           font_cov[(MAX_X > 256) ? MAX_X : 256];  /* copertura (bpp > 1): riga o glifo */
+static uint16_t          font_lut[16];                  /* colore di ogni livello per fg, bg, bpp */
+static uint16_t          font_lut_fg, font_lut_bg;
+static uint8_t           font_lut_bpp;                  /* 0: tabella da calcolare */
+
+/******************************************************************************
+** Function name:       font_glyph
+** Descriptions:        Glifo del carattere c, NULL se il font non lo ha.
+******************************************************************************/
+static const FONT_Glyph *font_glyph( const FONT_Font *f, uint8_t c )
+{
+    const FONT_Glyph *g;
+
+    if( c < f->first || c > f->last ){
+        return NULL;
+    }
+    g = &f->glyph[c - f->first];
+    return (g->adv == 0 && g->w == 0) ? NULL : g;
+}
+
+/******************************************************************************
+** Function name:       font_kern
+** Descriptions:        Correzione fra left e right: ricerca binaria.
+******************************************************************************/
+static int8_t font_kern( const FONT_Font *f, uint8_t left, uint8_t right )
+{
+    uint16_t lo = 0, hi = f->nkern, mid, key = (left << 8) | right, k;
+
+    while( lo < hi ){
+        mid = (lo + hi) >> 1;
+        k   = (f->kern[mid].left << 8) | f->kern[mid].right;
+        if( k == key ){
+            return f->kern[mid].dx;
+        }
+        if( k < key ){
+            lo = mid + 1;
+        }else{
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+/******************************************************************************
+** Function name:       font_or_row
+** Descriptions:        OR in font_row della riga r del glifo g, dalla colonna
+**                      c; i bit prima della colonna 0 e da 'width' in poi si
+**                      perdono.
+******************************************************************************/
+static void font_or_row( const FONT_Font *f, const FONT_Glyph *g, uint8_t r, int32_t c, int32_t width )
+{
+    const uint8_t *p = f->data + g->offset + r * ((g->w + 7) >> 3);
+    uint32_t v;
+    uint16_t b;
+    int32_t  x;
+    uint8_t  sh;
+
+    for( b = 0; b < g->w; b += 8 ){
+        x = c + b;
+        if( x >= width ){
+            return;
+        }
+        if( x <= -8 ){
+            continue;
+        }
+        v = (uint32_t)p[b >> 3] << 24;
+        if( x < 0 ){
+            v <<= -x;
+            x = 0;
+        }
+        sh = x & 31;
+        font_row[x >> 5] |= v >> sh;
+        if( sh > 24 ){
+            font_row[(x >> 5) + 1] |= v << (32 - sh);
+        }
+    }
+}
+
+/******************************************************************************
+** Function name:       font_max_row
+** Descriptions:        Come font_or_row per un font con bpp > 1: in font_cov
+**                      resta il livello piu' alto.
+******************************************************************************/
+static void font_max_row( const FONT_Font *f, const FONT_Glyph *g, uint8_t r, int32_t c, int32_t width )
+{
+    const uint8_t *p = f->data + g->offset + r * ((g->w * f->bpp + 7) >> 3);
+    uint8_t  bpp = f->bpp, mask = (1 << bpp) - 1, v, i, sh = 8;
+    int32_t  x;
+
+    for( i = 0; i < g->w; i++ ){
+        sh -= bpp;
+        v   = (*p >> sh) & mask;
+        if( sh == 0 ){
+            sh = 8;
+            p++;
+        }
+        x = c + i;
+        if( x >= width ){
+            return;
+        }
+        if( x >= 0 && v > font_cov[x] ){
+            font_cov[x] = v;
+        }
+    }
+}
+
+/******************************************************************************
+** Function name:       font_mask_row
+** Descriptions:        Riga r del glifo in font_row dalla colonna 0; con bpp > 1
+**                      accesi i pixel coperti almeno a meta'.
+******************************************************************************/
+static void font_mask_row( const FONT_Font *f, const FONT_Glyph *g, uint8_t r )
+{
+    uint8_t i, half = 1 << (f->bpp - 1);
+
+    for( i = 0; i <= (g->w - 1) >> 5; i++ ){
+        font_row[i] = 0;
+    }
+    if( f->bpp == 1 ){
+        font_or_row(f, g, r, 0, g->w);
+        return;
+    }
+    for( i = 0; i < g->w; i++ ){
+        font_cov[i] = 0;
+    }
+    font_max_row(f, g, r, 0, g->w);
+    for( i = 0; i < g->w; i++ ){
+        if( font_cov[i] >= half ){
+            font_row[i >> 5] |= 0x80000000UL >> (i & 31);
+        }
+    }
+}
+
+/******************************************************************************
+** Function name:       font_blend
+** Descriptions:        font_lut[i] = bg + (fg - bg) * i / max per canale, per
+**                      ogni livello i: la sola aritmetica sui colori, fatta
+**                      una volta per (fg, bg, bpp) e non per pixel.
+******************************************************************************/
+static void font_blend( uint8_t bpp, uint16_t fg, uint16_t bg )
+{
+    uint8_t  max = (1 << bpp) - 1, i;
+    uint16_t r, g, b;
+
+    if( bpp == font_lut_bpp && fg == font_lut_fg && bg == font_lut_bg ){
+        return;
+    }
+    for( i = 0; i <= max; i++ ){
+        r = ((fg >> 11) * i + (bg >> 11) * (max - i) + max / 2) / max;
+        g = (((fg >> 5) & 0x3f) * i + ((bg >> 5) & 0x3f) * (max - i) + max / 2) / max;
+        b = ((fg & 0x1f) * i + (bg & 0x1f) * (max - i) + max / 2) / max;
+        font_lut[i] = (r << 11) | (g << 5) | b;
+    }
+    font_lut_bpp = bpp;
+    font_lut_fg  = fg;
+    font_lut_bg  = bg;
+}
+
+/******************************************************************************
+** Function name:       font_run
+** Descriptions:        Lunghezza del tratto di bit uguali a quello della
+**                      colonna c (massimo end - c): __CLZ conta i bit uguali
+**                      di una parola alla volta.
+******************************************************************************/
+static uint16_t font_run( uint16_t c, uint16_t end, uint8_t on )
+{
+    uint16_t start = c;
+    uint32_t w;
+    uint8_t  sh, k;
+
+    while( c < end ){
+        sh = c & 31;
+        w  = (font_row[c >> 5] ^ (on ? 0xFFFFFFFF : 0)) << sh;
+        k  = w ? __CLZ(w) : 32;
+        if( k < 32 - sh ){
+            c += k;                 /* trovato un bit diverso */
+            break;
+        }
+        c += 32 - sh;
+    }
+    return ((c < end) ? c : end) - start;
+}
+
+/******************************************************************************
+** Function name:       font_bit
+** Descriptions:        Bit della colonna c di font_row.
+******************************************************************************/
+static uint8_t font_bit( uint16_t c )
+{
+    return (font_row[c >> 5] >> (31 - (c & 31))) & 1;
+}
+
+/******************************************************************************
+** Function name:       font_flush_aa
+** Descriptions:        Righe della finestra gia' aperta per un font con bpp > 1:
+**                      per ogni tratto di livello uguale un confronto per pixel,
+**                      poi un LCD_PushColor dalla tabella.
+******************************************************************************/
+static void font_flush_aa( const FONT_Font *f, uint8_t n, int32_t x0, uint16_t width, int32_t y0, int32_t y1,
+                           uint16_t Ypos )
+{
+    const FONT_Glyph *g;
+    uint16_t c, len;
+    int32_t  y, r;
+    uint8_t  k, v;
+
+    for( y = y0; y <= y1; y++ ){
+        for( c = 0; c < width; c++ ){
+            font_cov[c] = 0;
+        }
+        for( k = 0; k < n; k++ ){
+            g = font_gg[k];
+            r = y - Ypos - g->y;
+            if( r >= 0 && r < g->h ){
+                font_max_row(f, g, r, font_gx[k] - x0, width);
+            }
+        }
+        for( c = 0; c < width; c += len ){
+            v = font_cov[c];
+            for( len = 1; c + len < width && font_cov[c + len] == v; len++ ){
+            }
+            LCD_PushColor(font_lut[v], len);
+        }
+    }
+}
+
+/******************************************************************************
+** Function name:       font_flush
+** Descriptions:        Una finestra su x0..x1 x y0..y1 con i glifi raccolti:
+**                      per ogni riga la maschera e i suoi tratti, sfondo compreso.
+******************************************************************************/
+static void font_flush( const FONT_Font *f, uint8_t n, int32_t x0, int32_t x1, int32_t y0, int32_t y1,
+                        uint16_t Ypos, uint16_t charColor, uint16_t bkColor )
+{
+    const FONT_Glyph *g;
+    uint16_t width, c, len;
+    int32_t  y, r;
+    uint8_t  k, on;
+
+    if( x1 < x0 || y1 < y0 ){
+        return;
+    }
+    width = x1 - x0 + 1;
+    LCD_BeginPixels(x0, y0, width, y1 - y0 + 1);
+    if( f->bpp > 1 ){
+        font_flush_aa(f, n, x0, width, y0, y1, Ypos);
+        LCD_EndPixels();
+        return;
+    }
+    for( y = y0; y <= y1; y++ ){
+        for( k = 0; k <= (width - 1) >> 5; k++ ){
+            font_row[k] = 0;
+        }
+        for( k = 0; k < n; k++ ){
+            g = font_gg[k];
+            r = y - Ypos - g->y;
+            if( r >= 0 && r < g->h ){
+                font_or_row(f, g, r, font_gx[k] - x0, width);
+            }
+        }
+        for( c = 0; c < width; c += len ){
+            on  = font_bit(c);
+            len = font_run(c, width, on);
+            LCD_PushColor(on ? charColor : bkColor, len);
+        }
+    }
+    LCD_EndPixels();
+}
+
+/******************************************************************************
+** Function name:       font_width
+** Descriptions:        Avanzamenti e kerning fino a '\0'.
+******************************************************************************/
+uint16_t font_width( const FONT_Font *f, const char *str )
+{
+    const FONT_Glyph *g;
+    uint8_t  prev = 0;
+    int32_t  w = 0;
+
+    for( ; *str != 0; str++ ){
+        if( (g = font_glyph(f, *str)) == NULL ){
+            continue;
+        }
+        if( prev != 0 && f->nkern != 0 ){
+            w += font_kern(f, prev, *str);
+        }
+        w   += g->adv;
+        prev = *str;
+    }
+    return (w > 0) ? (uint16_t)w : 0;
+}
+
+/******************************************************************************
+** Function name:       font_draw
+** Descriptions:        Raccoglie i glifi con inchiostro nel clip (posizioni
+**                      dopo il kerning), poi una finestra per tutta la riga.
+**                      Se i glifi sono piu' di FONT_RUN la finestra si chiude
+**                      alla penna e se ne apre un'altra.
+******************************************************************************/
+uint16_t font_draw( uint16_t Xpos, uint16_t Ypos, const FONT_Font *f, const char *str,
+                    uint16_t charColor, uint16_t bkColor )
+{
+    const LCD_Rect   *clip = LCD_GetClip();
+    const FONT_Glyph *g;
+    int32_t  pen = Xpos, gx, wx0, y0, y1;
+    uint8_t  prev = 0, n = 0;
+
+    y0  = (clip->y0 > Ypos) ? clip->y0 : Ypos;
+    y1  = (clip->y1 < Ypos + f->height - 1) ? clip->y1 : Ypos + f->height - 1;
+    wx0 = (clip->x0 > Xpos) ? clip->x0 : Xpos;
+    if( f->bpp > 1 ){
+        font_blend(f->bpp, charColor, bkColor);
+    }
+
+    for( ; *str != 0; str++ ){
+        if( (g = font_glyph(f, *str)) == NULL ){
+            continue;
+        }
+        if( prev != 0 && f->nkern != 0 ){
+            pen += font_kern(f, prev, *str);
+        }
+        gx = pen + g->x;
+        if( g->w != 0 && gx + g->w > clip->x0 && gx <= clip->x1 ){
+            if( n == FONT_RUN ){
+                font_flush(f, n, wx0, (pen - 1 < clip->x1) ? pen - 1 : clip->x1, y0, y1, Ypos, charColor, bkColor);
+                wx0 = (pen > wx0) ? pen : wx0;
+                n   = 0;
+            }
+            font_gx[n]   = gx;
+            font_gg[n++] = g;
+        }
+        pen += g->adv;
+        prev = *str;
+    }
+    font_flush(f, n, wx0, (pen - 1 < clip->x1) ? pen - 1 : clip->x1, y0, y1, Ypos, charColor, bkColor);
+    return (pen > Xpos) ? (uint16_t)(pen - Xpos) : 0;
+}
+
+/******************************************************************************
+** Function name:       font_draw_over
+** Descriptions:        Glifo per glifo, riga per riga: ogni tratto acceso e'
+**                      un LCD_FillRect alto 1 (che taglia al clip).
+******************************************************************************/
+uint16_t font_draw_over( uint16_t Xpos, uint16_t Ypos, const FONT_Font *f, const char *str,
+                         uint16_t charColor )
+{
+    const LCD_Rect   *clip = LCD_GetClip();
+    const FONT_Glyph *g;
+    int32_t  pen = Xpos, gx, y, x0;
+    uint16_t c, len;
+    uint8_t  prev = 0, r;
+
+    for( ; *str != 0; str++ ){
+        if( (g = font_glyph(f, *str)) == NULL ){
+            continue;
+        }
+        if( prev != 0 && f->nkern != 0 ){
+            pen += font_kern(f, prev, *str);
+        }
+        gx = pen + g->x;
+        for( r = 0; r < g->h && gx + g->w > clip->x0 && gx <= clip->x1; r++ ){
+            y = Ypos + g->y + r;
+            if( y < clip->y0 || y > clip->y1 ){
+                continue;
+            }
+            font_mask_row(f, g, r);
+            for( c = 0; c < g->w; c += len ){
+                len = font_run(c, g->w, font_bit(c));
+                x0  = (gx + c > 0) ? gx + c : 0;
+                if( font_bit(c) && gx + c + len > x0 ){
+                    LCD_FillRect(x0, y, gx + c + len - x0, 1, charColor);
+                }
+            }
+        }
+        pen += g->adv;
+        prev = *str;
+    }
+    return (pen > Xpos) ? (uint16_t)(pen - Xpos) : 0;
+}
@@ -0,0 +1,52 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           gcache.h
+** Descriptions:        Cache LRU dei caratteri ASCII 8x16 gia' espansi in RGB565: per le scritte che si
+**                      ridisegnano a ogni frame con gli stessi colori (punti, vite, tempo) i pixel di
+**                      (carattere, colore, sfondo) si calcolano una volta e poi vanno dritti sul bus.
+**                      Il pool e' di GCACHE_SLOTS glifi; quando e' pieno si sostituisce quello usato
+**                      meno di recente. I contatori di gcache_stats servono a dimensionarlo.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __GCACHE_H
+#define __GCACHE_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+#include "../GLCD/GLCD.h"
+
+/* Glifi nel pool, 256 byte ciascuno: 32 sono 8 KB della IRAM da 32 KB (stack, heap e il
+ * resto del progetto). Un HUD come "PUNTI 001234 VITE 3 TEMPO 59" usa una ventina di glifi */
+#define GCACHE_SLOTS        32
+
+#define GCACHE_W            8
+#define GCACHE_H            16
+#define GCACHE_BYTES        ( GCACHE_SLOTS * GCACHE_W * GCACHE_H * 2 )
+
+#if ( GCACHE_SLOTS < 1 ) || ( GCACHE_SLOTS > 255 )
+#error "gcache: GCACHE_SLOTS fra 1 e 255"
+#endif
+
+typedef struct {
+    uint32_t hits;                  /* glifi trovati gia' espansi */
+    uint32_t misses;                /* glifi espansi (e messi nel pool) */
+    uint32_t evictions;             /* miss a pool pieno: un glifo e' stato sostituito */
+    uint16_t used;                  /* slot occupati */
+} GCACHE_Stats;
+
+/* Scrive str su una riga, senza andare a capo: una finestra GRAM sulla parte visibile,
+ * tagliata al clip del GLCD. I pixel sono gli stessi di GUI_Text. Ritorna la larghezza */
+extern uint16_t gcache_text( uint16_t Xpos, uint16_t Ypos, const char *str,
+                             uint16_t charColor, uint16_t bkColor );
+
+/* Un carattere, come PutChar */
+extern void gcache_putc( uint16_t Xpos, uint16_t Ypos, uint8_t c, uint16_t charColor, uint16_t bkColor );
+
+/* Svuota il pool (i contatori restano) */
+extern void gcache_clear( void );
+
+/* Contatori dall'ultimo gcache_stats_clear */
+extern const GCACHE_Stats *gcache_stats( void );
+extern void gcache_stats_clear( void );
+
+#endif /* end __GCACHE_H */
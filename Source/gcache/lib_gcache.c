@@ -0,0 +1,228 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_gcache.c
+** Descriptions:        Cache dei glifi espansi. La chiave e' (bitmap di GetASCIIGlyph, colore, sfondo):
+** i caratteri non stampabili, che hanno la bitmap dello spazio, occupano un solo slot. Gli slot si
+** trovano con una tabella hash a catene; ogni slot ricorda il tick dell'ultimo uso, e a pool pieno
+** si sostituisce quello col tick piu' vecchio (ricerca lineare, solo sui miss).
+** Una riga raccoglie gli slot dei glifi visibili e li scrive in una finestra: un glifo usato nella
+** riga ha il tick >= gc_run e non si sostituisce; se servirebbe farlo, la riga si spezza li'.
+** Correlated files:    gcache.h, AsciiLib.c (GetASCIIGlyph), GLCD.c (LCD_GetClip)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include "gcache.h"
+#include "../GLCD/AsciiLib.h"
+
+#define GCACHE_HASH_BITS    6                               /* 64 catene */
+#define GCACHE_HASH         ( 1 << GCACHE_HASH_BITS )
+#define GCACHE_RUN          ( MAX_X / GCACHE_W + 2 )        /* glifi che toccano il clip in una riga */
+
+static uint16_t             gc_px[GCACHE_SLOTS][GCACHE_W * GCACHE_H];   /* pixel riga per riga */
+static const unsigned char *gc_glyph[GCACHE_SLOTS];
+static uint32_t             gc_color[GCACHE_SLOTS];         /* colore << 16 | sfondo */
+static uint32_t             gc_used[GCACHE_SLOTS];          /* tick dell'ultimo uso */
+static uint8_t              gc_next[GCACHE_SLOTS];          /* catena: slot + 1, 0 in fondo */
+static uint8_t              gc_head[GCACHE_HASH];           /* primo slot + 1 di ogni catena, 0 vuota */
+static uint32_t             gc_tick;
+static uint32_t             gc_run;                         /* tick di inizio della riga in corso */
+static const uint16_t      *gc_run_px[GCACHE_RUN];
+static GCACHE_Stats         gc_stats;
+
+/******************************************************************************
+** Function name:       gcache_hash
+** Descriptions:        Catena di (glifo, colori): moltiplicazione di Fibonacci.
+******************************************************************************/
+static uint8_t gcache_hash( const unsigned char *glyph, uint32_t color )
+{
+    return (uint8_t)((((uint32_t)(uintptr_t)glyph ^ color) * 2654435761u) >> (32 - GCACHE_HASH_BITS));
+}
+
+/******************************************************************************
+** Function name:       gcache_unlink
+** Descriptions:        Toglie lo slot s dalla sua catena.
+******************************************************************************/
+static void gcache_unlink( uint8_t s )
+{
+    uint8_t *p = &gc_head[gcache_hash(gc_glyph[s], gc_color[s])];
+
+    while( *p != s + 1 ){
+        p = &gc_next[*p - 1];
+    }
+    *p = gc_next[s];
+}
+
+/******************************************************************************
+** Function name:       gcache_slot
+** Descriptions:        Pixel del glifo nei colori color. Con un miss il glifo
+**                      si espande nello slot libero o in quello usato meno di
+**                      recente; NULL se tutti sono della riga in corso.
+******************************************************************************/
+static const uint16_t *gcache_slot( const unsigned char *glyph, uint32_t color )
+{
+    uint8_t   h = gcache_hash(glyph, color), s, i, j, bits;
+    uint16_t  fg = (uint16_t)(color >> 16), bg = (uint16_t)color, *px;
+
+    for( s = gc_head[h]; s != 0; s = gc_next[s - 1] ){
+        if( gc_glyph[s - 1] == glyph && gc_color[s - 1] == color ){
+            gc_used[s - 1] = ++gc_tick;
+            gc_stats.hits++;
+            return gc_px[s - 1];
+        }
+    }
+
+    if( gc_stats.used < GCACHE_SLOTS ){
+        s = (uint8_t)gc_stats.used;
+    }else{
+        for( s = 0, i = 1; i < GCACHE_SLOTS; i++ ){
+            if( gc_used[i] < gc_used[s] ){
+                s = i;
+            }
+        }
+        if( gc_used[s] >= gc_run ){
+            return NULL;
+        }
+        gcache_unlink(s);
+        gc_stats.evictions++;
+    }
+    gc_stats.misses++;
+
+    px = gc_px[s];
+    for( i = 0; i < GCACHE_H; i++ ){
+        bits = glyph[i];
+        for( j = 0; j < GCACHE_W; j++ ){
+            *px++ = (bits & 0x80) ? fg : bg;
+            bits <<= 1;
+        }
+    }
+    if( s == gc_stats.used ){
+        gc_stats.used++;
+    }
+    gc_glyph[s] = glyph;
+    gc_color[s] = color;
+    gc_used[s]  = ++gc_tick;
+    gc_next[s]  = gc_head[h];
+    gc_head[h]  = s + 1;
+    return gc_px[s];
+}
+
+/******************************************************************************
+** Function name:       gcache_flush
+** Descriptions:        Scrive gli n glifi raccolti dalla colonna gx: finestra
+**                      sulla parte visibile, righe y0..y1 (relative a Ypos);
+**                      ogni riga di ogni glifo e' un LCD_PushPixels dallo slot.
+******************************************************************************/
+static void gcache_flush( int32_t gx, uint16_t Ypos, uint8_t n, int16_t y0, int16_t y1 )
+{
+    const LCD_Rect *clip = LCD_GetClip();
+    int32_t  x0, x1;
+    int16_t  y;
+    uint8_t  k, k0, k1, a, b;
+
+    x0 = (clip->x0 > gx) ? clip->x0 - gx : 0;
+    x1 = (clip->x1 < gx + GCACHE_W * n - 1) ? clip->x1 - gx : GCACHE_W * n - 1;
+    if( n == 0 || x1 < x0 ){
+        return;
+    }
+    k0 = (uint8_t)(x0 / GCACHE_W);
+    k1 = (uint8_t)(x1 / GCACHE_W);
+
+    LCD_BeginPixels(gx + x0, Ypos + y0, x1 - x0 + 1, y1 - y0 + 1);
+    for( y = y0; y <= y1; y++ ){
+        for( k = k0; k <= k1; k++ ){
+            a = (k == k0) ? x0 % GCACHE_W : 0;
+            b = (k == k1) ? x1 % GCACHE_W : GCACHE_W - 1;
+            LCD_PushPixels(&gc_run_px[k][y * GCACHE_W + a], b - a + 1);
+        }
+    }
+    LCD_EndPixels();
+}
+
+/******************************************************************************
+** Function name:       gcache_text
+** Descriptions:        Raccoglie gli slot dei glifi che toccano il clip e li
+**                      scrive in una finestra; la riga si spezza solo se il
+**                      pool non basta per tutti i suoi glifi diversi.
+******************************************************************************/
+uint16_t gcache_text( uint16_t Xpos, uint16_t Ypos, const char *str,
+                      uint16_t charColor, uint16_t bkColor )
+{
+    const LCD_Rect *clip = LCD_GetClip();
+    const uint8_t  *s = (const uint8_t *)str;
+    const uint16_t *px;
+    uint32_t color = (uint32_t)charColor << 16 | bkColor;
+    int32_t  x = Xpos, gx = 0;
+    int16_t  y0, y1;
+    uint8_t  n = 0;
+
+    y0 = (clip->y0 > Ypos) ? clip->y0 - Ypos : 0;
+    y1 = (clip->y1 < Ypos + GCACHE_H - 1) ? clip->y1 - Ypos : GCACHE_H - 1;
+
+    gc_run = gc_tick + 1;
+    for( ; *s != 0; s++, x += GCACHE_W ){
+        if( y0 > y1 || x + GCACHE_W <= clip->x0 || x > clip->x1 ){
+            continue;
+        }
+        px = gcache_slot(GetASCIIGlyph(*s), color);
+        if( px == NULL ){
+            /* pool pieno di glifi di questa riga: si scrive quello che c'e' */
+            gcache_flush(gx, Ypos, n, y0, y1);
+            n      = 0;
+            gc_run = gc_tick + 1;
+            px     = gcache_slot(GetASCIIGlyph(*s), color);
+        }
+        if( n == 0 ){
+            gx = x;
+        }
+        gc_run_px[n++] = px;
+    }
+    gcache_flush(gx, Ypos, n, y0, y1);
+    return (uint16_t)(x - Xpos);
+}
+
+/******************************************************************************
+** Function name:       gcache_putc
+** Descriptions:        gcache_text di un carattere.
+******************************************************************************/
+void gcache_putc( uint16_t Xpos, uint16_t Ypos, uint8_t c, uint16_t charColor, uint16_t bkColor )
+{
+    char str[2];
+
+    str[0] = (char)((c != 0) ? c : ' ');    /* '\0' e' uno spazio anche per PutChar */
+    str[1] = 0;
+    gcache_text(Xpos, Ypos, str, charColor, bkColor);
+}
+
+/******************************************************************************
+** Function name:       gcache_clear
+** Descriptions:        Catene vuote e nessuno slot occupato.
+******************************************************************************/
+void gcache_clear( void )
+{
+    uint8_t h;
+
+    for( h = 0; h < GCACHE_HASH; h++ ){
+        gc_head[h] = 0;
+    }
+    gc_stats.used = 0;
+}
+
+/******************************************************************************
+** Function name:       gcache_stats
+** Descriptions:        Contatori correnti.
+******************************************************************************/
+const GCACHE_Stats *gcache_stats( void )
+{
+    return &gc_stats;
+}
+
+/******************************************************************************
+** Function name:       gcache_stats_clear
+** Descriptions:        Azzera hit, miss e sostituzioni; used resta.
+******************************************************************************/
+void gcache_stats_clear( void )
+{
+    gc_stats.hits      = 0;
+    gc_stats.misses    = 0;
+    gc_stats.evictions = 0;
+}
@@ -0,0 +1,115 @@
+/* Generato da Host/hz2c.cpp: 44 caratteri di HzLib, 1408 -> 1176 byte (+ 354 di indici) */
+#include "hzfont.h"
+
+static const uint16_t hz_font_ucs[44] = {
+    0x4e2d, 0x4e8e, 0x505c, 0x5173, 0x5206, 0x5355, 0x53d6, 0x547d, 0x56de, 0x58f0,
+    0x59cb, 0x5b57, 0x5b9a, 0x5f00, 0x5f97, 0x620f, 0x6570, 0x6587, 0x65f6, 0x6682,
+    0x6700, 0x675f, 0x6c49, 0x6d4b, 0x6d88, 0x6e38, 0x751f, 0x786e, 0x7b49, 0x7ea7,
+    0x7ed3, 0x7ee7, 0x7eed, 0x7f6e, 0x83dc, 0x8a00, 0x8bbe, 0x8bd5, 0x8bed, 0x8fd4,
+    0x91cf, 0x95f4, 0x97f3, 0x9ad8,
+};
+
+static const uint16_t hz_font_gb[44] = {
+    0xb2cb, 0xb2e2, 0xb5a5, 0xb5c3, 0xb5c8, 0xb6a8, 0xb7b5, 0xb7d6, 0xb8df, 0xb9d8,
+    0xbaba, 0xbbd8, 0xbcb6, 0xbccc, 0xbce4, 0xbde1, 0xbfaa, 0xc1bf, 0xc3fc, 0xc8a1,
+    0xc8b7, 0xc9e8, 0xc9f9, 0xc9fa, 0xcab1, 0xcabc, 0xcad4, 0xcaf8, 0xcafd, 0xcda3,
+    0xcec4, 0xcfb7, 0xcffb, 0xd0f8, 0xd1d4, 0xd2f4, 0xd3ce, 0xd3da, 0xd3ef, 0xd4dd,
+    0xd6c3, 0xd6d0, 0xd7d6, 0xd7ee,
+};
+
+static const uint16_t hz_font_gb_glyph[44] = {
+    0x0022, 0x0017, 0x0005, 0x000e, 0x001c, 0x000c, 0x0027, 0x0004, 0x002b, 0x0003,
+    0x0016, 0x0008, 0x001d, 0x001f, 0x0029, 0x001e, 0x000d, 0x0028, 0x0007, 0x0006,
+    0x001b, 0x0024, 0x0009, 0x001a, 0x0012, 0x000a, 0x0025, 0x0015, 0x0010, 0x0002,
+    0x0011, 0x000f, 0x0018, 0x0020, 0x0023, 0x002a, 0x0019, 0x0001, 0x0026, 0x0013,
+    0x0021, 0x0000, 0x000b, 0x0014,
+};
+
+static const uint16_t hz_font_offset[45] = {
+    0x0000, 0x000d, 0x001c, 0x003a, 0x0051, 0x0068, 0x007e, 0x009b, 0x00b6, 0x00c7,
+    0x00e0, 0x00fb, 0x0112, 0x012b, 0x013c, 0x015c, 0x017c, 0x019a, 0x01b7, 0x01d0,
+    0x01ee, 0x020c, 0x0225, 0x0242, 0x025f, 0x027d, 0x029d, 0x02b0, 0x02d0, 0x02ed,
+    0x0309, 0x0327, 0x0345, 0x0363, 0x037f, 0x039c, 0x03b3, 0x03d3, 0x03f0, 0x040e,
+    0x042e, 0x044c, 0x0464, 0x047d, 0x0498,
+};
+
+static const uint8_t hz_font_data[1176] = {
+    0x0e, 0x2b, 0x06, 0x03, 0xff, 0xee, 0x31, 0x9f, 0xff, 0x71, 0x8e, 0x0c, 0x00, 0x1d, 0x0e, 0x3f,
+    0xf8, 0x80, 0xc0, 0x3f, 0xff, 0xd0, 0x18, 0x01, 0x07, 0x81, 0x07, 0x00, 0x0e, 0x0e, 0x18, 0x61,
+    0x1f, 0xff, 0x37, 0xff, 0x30, 0x01, 0x73, 0xfd, 0xf3, 0x0d, 0xb3, 0xfd, 0x30, 0x01, 0x37, 0xff,
+    0x34, 0x03, 0x33, 0xfd, 0x30, 0x60, 0x98, 0xf0, 0x98, 0x60, 0x0e, 0x1d, 0x18, 0x61, 0x0c, 0xc3,
+    0xff, 0xf2, 0x06, 0x03, 0xff, 0xfa, 0x06, 0x04, 0x1e, 0x08, 0x66, 0x11, 0x86, 0x2e, 0x07, 0xf8,
+    0x06, 0x1d, 0x1d, 0x0c, 0xc1, 0x18, 0xe2, 0x60, 0xe5, 0x80, 0xef, 0xff, 0xfb, 0xfe, 0xa1, 0x8c,
+    0x11, 0x86, 0x26, 0x0c, 0x78, 0x70, 0xa0, 0xc0, 0x0e, 0x1d, 0x18, 0x62, 0x19, 0x85, 0xff, 0xe5,
+    0x8c, 0x6b, 0xff, 0xcb, 0x18, 0xd7, 0xff, 0x90, 0x30, 0x3f, 0xff, 0xa0, 0x60, 0x00, 0x0e, 0x0e,
+    0xfe, 0x01, 0xfe, 0xfd, 0x66, 0xfd, 0x66, 0x6c, 0xbf, 0x36, 0xb3, 0x36, 0x5f, 0x9b, 0x59, 0x8e,
+    0x59, 0xcc, 0x7f, 0xce, 0x7d, 0xbb, 0xc1, 0xb1, 0x41, 0x80, 0x00, 0x0e, 0x1d, 0x06, 0x02, 0x0e,
+    0x04, 0x36, 0x08, 0xc6, 0x13, 0xff, 0x3d, 0xf7, 0xf0, 0x02, 0xbe, 0xf8, 0xb6, 0xd8, 0xbe, 0xd9,
+    0x7d, 0xf2, 0xc3, 0x04, 0x06, 0x00, 0x1d, 0x1c, 0xff, 0xfb, 0x80, 0x3e, 0xfc, 0xdd, 0x99, 0x9d,
+    0xf9, 0xb8, 0x03, 0xff, 0xfd, 0xc0, 0x18, 0x0e, 0x0d, 0x01, 0x82, 0xff, 0xfa, 0x03, 0x04, 0xff,
+    0xe8, 0x00, 0x13, 0xff, 0x93, 0x19, 0xa7, 0xff, 0x26, 0x03, 0x4c, 0x00, 0xb0, 0x01, 0xc0, 0x00,
+    0x0e, 0x0e, 0x30, 0x60, 0x7f, 0x32, 0x7f, 0x63, 0x5b, 0x7f, 0xad, 0x80, 0x39, 0xbf, 0xad, 0xbf,
+    0xa7, 0x31, 0xa3, 0xb1, 0xa6, 0xbf, 0xac, 0x3f, 0xb8, 0x31, 0x80, 0x0e, 0x1d, 0x06, 0x02, 0x06,
+    0x07, 0xff, 0xf7, 0x00, 0x39, 0xff, 0x08, 0x0c, 0x10, 0x30, 0x3f, 0xff, 0xa0, 0x60, 0x21, 0xe0,
+    0x43, 0x80, 0x0e, 0x0e, 0x01, 0x80, 0xbf, 0xff, 0x58, 0x01, 0xc7, 0xfe, 0x20, 0x30, 0x23, 0x30,
+    0x23, 0x3f, 0x93, 0x98, 0x13, 0xf8, 0x16, 0x7f, 0xfc, 0x1f, 0xe0, 0x1d, 0x0e, 0x7f, 0xfc, 0x86,
+    0x30, 0x3f, 0xff, 0xd0, 0xc6, 0x04, 0x61, 0x82, 0xe0, 0xc2, 0x40, 0xc0, 0x0e, 0x0e, 0x1b, 0xfd,
+    0x33, 0xfd, 0x33, 0x0d, 0x63, 0xfd, 0xdb, 0x0d, 0x1b, 0xfd, 0x30, 0x01, 0x77, 0xff, 0xf7, 0xff,
+    0xb0, 0x19, 0x37, 0xff, 0x33, 0x19, 0x31, 0x99, 0x30, 0x79, 0x30, 0x70, 0x0e, 0x0e, 0x00, 0xc1,
+    0x00, 0xd1, 0xfc, 0xd9, 0xfc, 0xc9, 0x0c, 0xfd, 0x0f, 0xfd, 0x6f, 0xc1, 0x6c, 0xc9, 0x38, 0xd9,
+    0x18, 0xd9, 0x3c, 0x71, 0x64, 0x63, 0xc0, 0xf7, 0x83, 0x9f, 0x03, 0x0e, 0x0e, 0x0e, 0x4d, 0x61,
+    0x6f, 0x61, 0x2e, 0x61, 0xff, 0x7e, 0x97, 0x66, 0xb6, 0xe6, 0x8c, 0x66, 0xff, 0xb6, 0xff, 0xb4,
+    0x99, 0x9c, 0x9f, 0x18, 0x8f, 0xbc, 0x98, 0xe6, 0xf0, 0x43, 0x0e, 0x0e, 0x02, 0x01, 0x03, 0x01,
+    0x01, 0x81, 0xff, 0xfe, 0x8c, 0x30, 0x43, 0x18, 0x43, 0x30, 0x41, 0xb0, 0x40, 0xe0, 0x41, 0xf0,
+    0x47, 0xbc, 0x5e, 0x0f, 0xd8, 0x03, 0x00, 0x0e, 0x0e, 0x00, 0x19, 0xfc, 0x18, 0xe6, 0xff, 0x73,
+    0x06, 0x7f, 0x06, 0x7f, 0x66, 0x73, 0x36, 0x3f, 0x83, 0x1c, 0xc1, 0x90, 0x03, 0x90, 0x03, 0x00,
+    0x0e, 0x1d, 0x30, 0x3b, 0xfd, 0xf7, 0xfb, 0x0a, 0xc7, 0xf7, 0xef, 0xe3, 0x16, 0x7f, 0x6c, 0xfc,
+    0x99, 0x18, 0x02, 0x7f, 0xe4, 0xc0, 0xc9, 0xff, 0x93, 0x03, 0x27, 0xfe, 0x4c, 0x0c, 0x0e, 0x0e,
+    0x1f, 0xf9, 0x18, 0x19, 0x1f, 0xf9, 0x18, 0x19, 0x1f, 0xf9, 0x00, 0x01, 0xff, 0xfe, 0x99, 0x80,
+    0x9f, 0xfc, 0x99, 0xac, 0x9f, 0xb8, 0x99, 0xd8, 0xbf, 0xac, 0x81, 0xc6, 0x0e, 0x1d, 0x03, 0x01,
+    0xff, 0xfd, 0x03, 0x02, 0xff, 0xf2, 0xc6, 0x35, 0xff, 0xe8, 0x7c, 0x11, 0xbc, 0x26, 0x6c, 0x78,
+    0xce, 0xe1, 0x8d, 0x03, 0x00, 0x0e, 0x1d, 0xc0, 0x02, 0xdf, 0xe4, 0xbf, 0xc8, 0x31, 0x98, 0x63,
+    0x38, 0xc6, 0x58, 0xcc, 0x81, 0xb1, 0x43, 0x62, 0xc3, 0x83, 0x86, 0xc7, 0x18, 0xce, 0xe0, 0xf1,
+    0x80, 0x80, 0x0e, 0x1c, 0x00, 0x1e, 0x7c, 0x7d, 0xf5, 0xd4, 0x57, 0x15, 0x5e, 0x55, 0x7d, 0x55,
+    0xd5, 0x57, 0x15, 0x5d, 0x55, 0x74, 0x45, 0xd3, 0x47, 0xc9, 0x9e, 0x62, 0xf9, 0x03, 0x00, 0x0e,
+    0x0d, 0x00, 0x62, 0xcc, 0xcc, 0xcd, 0xb8, 0x83, 0x10, 0x3f, 0xf8, 0x7f, 0xd8, 0xc3, 0x91, 0x87,
+    0x03, 0xfe, 0x26, 0x1c, 0xcf, 0xf9, 0x98, 0x76, 0x30, 0xec, 0x67, 0xd0, 0xc6, 0x0e, 0x0e, 0x04,
+    0x31, 0xc6, 0x31, 0x62, 0x3f, 0x1f, 0x7f, 0x1f, 0xc1, 0xcc, 0xbf, 0x6f, 0x3f, 0x0f, 0x0d, 0x0d,
+    0x7f, 0x2d, 0x7f, 0x2d, 0x19, 0x6d, 0x19, 0x4d, 0x19, 0xdd, 0x39, 0xdb, 0x30, 0x0e, 0x0e, 0x01,
+    0x81, 0x31, 0x80, 0x5f, 0xfe, 0x38, 0x30, 0x20, 0x30, 0x23, 0xfe, 0x10, 0x18, 0x07, 0xff, 0xf8,
+    0x0e, 0x0e, 0x00, 0xc1, 0x7c, 0xf9, 0x7d, 0xf9, 0x33, 0x31, 0x33, 0xff, 0x61, 0xff, 0x7d, 0xb7,
+    0xed, 0xff, 0x6d, 0xff, 0x6d, 0xb7, 0x6d, 0xff, 0x7d, 0xb7, 0x6d, 0xb7, 0x63, 0x3f, 0x02, 0x0c,
+    0x0e, 0x0e, 0x30, 0x61, 0x3f, 0x7f, 0x7f, 0xff, 0xec, 0xd9, 0x4d, 0x81, 0x3f, 0xf8, 0x80, 0xc0,
+    0xff, 0xff, 0x80, 0x18, 0xbf, 0xfe, 0x43, 0x0c, 0x41, 0x8c, 0x40, 0x38, 0x00, 0x1d, 0x0e, 0x37,
+    0xf8, 0xb2, 0xcc, 0xe6, 0xd8, 0xfc, 0xde, 0x98, 0xc6, 0xb0, 0xc6, 0xfc, 0xe6, 0xfc, 0xec, 0x81,
+    0xbc, 0x8d, 0x98, 0xff, 0x3c, 0xf2, 0xe6, 0x84, 0xc3, 0x0e, 0x0e, 0x00, 0x61, 0x30, 0x61, 0x33,
+    0xff, 0x63, 0xff, 0xcc, 0x61, 0xfd, 0xfd, 0x31, 0xfd, 0x60, 0x01, 0xfd, 0xfc, 0x80, 0xc6, 0x8e,
+    0xc6, 0xfe, 0xfe, 0xf0, 0xfe, 0x80, 0xc6, 0x1d, 0x0e, 0x30, 0x31, 0x20, 0xb5, 0x63, 0xf5, 0x4b,
+    0x79, 0xfb, 0x31, 0xfb, 0xff, 0x33, 0xff, 0x63, 0x31, 0xfb, 0x7d, 0xfb, 0xf7, 0x03, 0xb3, 0x3b,
+    0x31, 0xe3, 0xff, 0x03, 0xfe, 0x0e, 0x0e, 0x00, 0x61, 0x31, 0xfc, 0xb0, 0x30, 0xe5, 0xff, 0xfc,
+    0x03, 0x98, 0xdb, 0xb0, 0x58, 0xfd, 0x98, 0xfc, 0x98, 0x81, 0xff, 0x8d, 0xff, 0xfc, 0x6c, 0xf1,
+    0xc7, 0x81, 0x83, 0x1d, 0x0e, 0x3f, 0xfd, 0x32, 0x4d, 0x3f, 0xfd, 0x01, 0x81, 0x7f, 0xff, 0x01,
+    0x81, 0x1f, 0xf9, 0x18, 0x19, 0x1f, 0xf9, 0x18, 0x19, 0x1f, 0xf9, 0x18, 0x19, 0xff, 0xfe, 0x0e,
+    0x0e, 0x06, 0x61, 0x7f, 0xfc, 0x83, 0x30, 0x80, 0x7c, 0x9f, 0xe0, 0x89, 0x8c, 0x8c, 0xd8, 0x80,
+    0xc0, 0xff, 0xff, 0x43, 0x78, 0x46, 0x6c, 0x5c, 0x67, 0xd8, 0x63, 0x00, 0x0e, 0x0d, 0x03, 0x01,
+    0xff, 0xfd, 0x00, 0x02, 0x7f, 0xe4, 0x00, 0x09, 0xff, 0x90, 0x00, 0x27, 0xfe, 0x26, 0x06, 0x4f,
+    0xfc, 0x4c, 0x0c, 0x0e, 0x0e, 0x23, 0xf1, 0x33, 0xf1, 0x1b, 0x31, 0x13, 0x31, 0x07, 0x3f, 0xf6,
+    0x1f, 0xf7, 0xf9, 0x37, 0xf9, 0x33, 0x19, 0x33, 0x31, 0x31, 0xb1, 0x3c, 0xe1, 0x39, 0xf1, 0x37,
+    0x9f, 0x06, 0x0c, 0x0e, 0x0e, 0x00, 0x69, 0x60, 0x6d, 0x30, 0x65, 0x37, 0xff, 0x07, 0xff, 0xf0,
+    0x61, 0xf7, 0xe1, 0x37, 0xe1, 0x33, 0x30, 0x4e, 0xf5, 0xcf, 0xf7, 0xcd, 0x83, 0xc0, 0x01, 0x00,
+    0x1d, 0x0e, 0x67, 0xfd, 0x37, 0xfd, 0x30, 0xc1, 0x03, 0xf9, 0xf1, 0x99, 0xf7, 0xff, 0x37, 0xff,
+    0x30, 0x01, 0x33, 0xfd, 0x33, 0x0d, 0x3b, 0x0d, 0x3b, 0xfd, 0x33, 0xfd, 0x23, 0x0c, 0x0e, 0x0e,
+    0x00, 0x19, 0x63, 0xfd, 0x33, 0xc1, 0x33, 0x01, 0x03, 0xf9, 0xf3, 0xf9, 0xf3, 0x19, 0x33, 0xd9,
+    0x33, 0x71, 0x36, 0x39, 0x36, 0x6d, 0x35, 0xc5, 0x7c, 0x01, 0xef, 0xff, 0x43, 0xfe, 0x0e, 0x1d,
+    0x3f, 0xf2, 0x60, 0x64, 0xff, 0xc9, 0x81, 0x93, 0xff, 0x20, 0x00, 0x7f, 0xff, 0x99, 0x99, 0x3f,
+    0xf2, 0x66, 0x64, 0xff, 0xc8, 0x18, 0x17, 0xff, 0xa0, 0x60, 0x7f, 0xff, 0x0e, 0x1c, 0x60, 0x05,
+    0xdf, 0xf3, 0x7f, 0xf0, 0x07, 0xdf, 0xdb, 0xb1, 0xb7, 0x7f, 0x7d, 0x8d, 0xf7, 0xf6, 0xe0, 0x0f,
+    0x80, 0xfe, 0x01, 0x80, 0x0e, 0x1d, 0x03, 0x02, 0xff, 0xf2, 0x30, 0xc4, 0x33, 0x0f, 0xff, 0xe8,
+    0x00, 0x13, 0xff, 0x26, 0x06, 0x4f, 0xfc, 0x98, 0x19, 0x3f, 0xf1, 0x30, 0x30, 0x0e, 0x1c, 0x03,
+    0x07, 0xff, 0xe8, 0x00, 0x27, 0xfc, 0x98, 0x32, 0x7f, 0xc8, 0x00, 0x3f, 0xff, 0xe0, 0x0f, 0xbf,
+    0xbe, 0xc6, 0xfb, 0xfb, 0xe0, 0x1f, 0x80, 0x60,
+};
+
+extern const HZ_Font hz_font;
+
+const HZ_Font hz_font = { 44, hz_font_ucs, hz_font_gb, hz_font_gb_glyph, hz_font_offset, hz_font_data };
@@ -0,0 +1,51 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           hzfont.h
+** Descriptions:        Caratteri cinesi 16x16 da un sottoinsieme compresso di HzLib, generato con
+**                      Host/hz2c.cpp dai soli caratteri usati dall'applicazione. I glifi si cercano
+**                      per codice Unicode o GB2312 (ricerca binaria) e si disegnano direttamente
+**                      nella finestra GRAM. HzLib.c resta solo come sorgente per hz2c.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __HZFONT_H
+#define __HZFONT_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+#include "../GLCD/GLCD.h"
+
+#define HZ_SIZE             16
+
+/* Glifo compresso (byte allineato, bit dal piu' significativo):
+ *   top << 4 | (h - 1)     righe top..top+h-1 non vuote (0xFF: glifo vuoto, nient'altro)
+ *   left << 4 | (w - 1)    colonne left..left+w-1
+ *   per ogni riga dopo la prima: 0 = uguale alla precedente, 1 = seguono w bit
+ *   (la prima riga ha sempre i suoi w bit). Fuori dal rettangolo i pixel sono spenti. */
+#define HZ_EMPTY            0xFF
+
+/* Un font generato da hz2c: count glifi, due indici ordinati e i dati */
+typedef struct {
+    uint16_t        count;
+    const uint16_t *ucs;            /* codici Unicode crescenti, glifo i */
+    const uint16_t *gb;             /* codici GB2312 (alto << 8 | basso) crescenti */
+    const uint16_t *gb_glyph;       /* glifo di gb[i] */
+    const uint16_t *offset;         /* count + 1 posizioni in data */
+    const uint8_t  *data;
+} HZ_Font;
+
+/* Font dei caratteri elencati in hz_chars.txt (hz_font.c, generato) */
+extern const HZ_Font hz_font;
+
+/* Glifo del codice Unicode o GB2312 (2 byte, come nelle stringhe GBK), -1 se manca */
+extern int16_t hz_find( const HZ_Font *f, uint16_t ucs );
+extern int16_t hz_find_gb( const HZ_Font *f, const uint8_t *gb );
+
+/* Decomprime il glifo in 16 righe (bit 15 = colonna sinistra): per chi compone piu'
+ * glifi nella stessa finestra */
+extern void hz_rows( const HZ_Font *f, int16_t glyph, uint16_t rows[HZ_SIZE] );
+
+/* Disegna il glifo in una finestra 16x16 (tagliata al clip del GLCD), decomprimendo
+ * riga per riga mentre scrive. glyph < 0: non disegna nulla */
+extern void hz_draw( uint16_t Xpos, uint16_t Ypos, const HZ_Font *f, int16_t glyph, uint16_t fg, uint16_t bg );
+
+#endif /* end __HZFONT_H */
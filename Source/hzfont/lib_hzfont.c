@@ -0,0 +1,170 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_hzfont.c
+** Descriptions:        Ricerca e decompressione dei glifi di hz_font.c. Il decoder tiene solo la riga
+** corrente e un accumulatore di bit: nessuna copia del glifo (prima GetGBKCode ne copiava 32 byte).
+** Correlated files:    hzfont.h, hz_font.c (generato), Host/hz2c.cpp, GLCD.c (LCD_GetClip)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include "hzfont.h"
+
+typedef struct {
+    const uint8_t *p;               /* prossimo byte */
+    uint32_t       acc;             /* bit letti e non ancora usati (i bassi 'n') */
+    uint8_t        n;
+    uint8_t        top, h, left, w;
+    uint16_t       row;             /* ultima riga decodificata, gia' allineata */
+} HZ_Dec;
+
+/******************************************************************************
+** Function name:       hz_search
+** Descriptions:        Ricerca binaria di key in keys[0..count-1]: -1 se manca.
+******************************************************************************/
+static int16_t hz_search( const uint16_t *keys, uint16_t count, uint16_t key )
+{
+    uint16_t lo = 0, hi = count, mid;
+
+    while( lo < hi ){
+        mid = (lo + hi) >> 1;
+        if( keys[mid] < key ){
+            lo = mid + 1;
+        }else{
+            hi = mid;
+        }
+    }
+    return (lo < count && keys[lo] == key) ? (int16_t)lo : -1;
+}
+
+/******************************************************************************
+** Function name:       hz_find
+** Descriptions:        Glifo del codice Unicode.
+******************************************************************************/
+int16_t hz_find( const HZ_Font *f, uint16_t ucs )
+{
+    return hz_search(f->ucs, f->count, ucs);
+}
+
+/******************************************************************************
+** Function name:       hz_find_gb
+** Descriptions:        Glifo del codice GB2312 (byte alto, byte basso).
+******************************************************************************/
+int16_t hz_find_gb( const HZ_Font *f, const uint8_t *gb )
+{
+    int16_t i = hz_search(f->gb, f->count, (gb[0] << 8) | gb[1]);
+
+    return (i < 0) ? -1 : (int16_t)f->gb_glyph[i];
+}
+
+/******************************************************************************
+** Function name:       hz_bits
+** Descriptions:        I prossimi k bit (k <= 16) del glifo.
+******************************************************************************/
+static uint16_t hz_bits( HZ_Dec *d, uint8_t k )
+{
+    while( d->n < k ){
+        d->acc = (d->acc << 8) | *d->p++;
+        d->n  += 8;
+    }
+    d->n -= k;
+    return (d->acc >> d->n) & ((1UL << k) - 1);
+}
+
+/******************************************************************************
+** Function name:       hz_begin
+** Descriptions:        Legge l'intestazione del glifo.
+******************************************************************************/
+static void hz_begin( HZ_Dec *d, const HZ_Font *f, int16_t glyph )
+{
+    const uint8_t *g = f->data + f->offset[glyph];
+
+    d->n   = 0;
+    d->acc = 0;
+    d->row = 0;
+    if( g[0] == HZ_EMPTY ){
+        d->top = HZ_SIZE;
+        d->h   = 0;
+        return;
+    }
+    d->top  = g[0] >> 4;
+    d->h    = (g[0] & 0x0f) + 1;
+    d->left = g[1] >> 4;
+    d->w    = (g[1] & 0x0f) + 1;
+    d->p    = g + 2;
+}
+
+/******************************************************************************
+** Function name:       hz_next
+** Descriptions:        Riga y del glifo: le righe vanno chieste in ordine, 0..15.
+******************************************************************************/
+static uint16_t hz_next( HZ_Dec *d, uint8_t y )
+{
+    if( y < d->top || y >= d->top + d->h ){
+        return 0;
+    }
+    if( y == d->top || hz_bits(d, 1) ){
+        d->row = hz_bits(d, d->w) << (HZ_SIZE - d->left - d->w);
+    }
+    return d->row;
+}
+
+/******************************************************************************
+** Function name:       hz_rows
+** Descriptions:        Tutte le 16 righe del glifo.
+******************************************************************************/
+void hz_rows( const HZ_Font *f, int16_t glyph, uint16_t rows[HZ_SIZE] )
+{
+    HZ_Dec  d;
+    uint8_t y;
+
+    if( glyph < 0 ){
+        for( y = 0; y < HZ_SIZE; y++ ){
+            rows[y] = 0;
+        }
+        return;
+    }
+    hz_begin(&d, f, glyph);
+    for( y = 0; y < HZ_SIZE; y++ ){
+        rows[y] = hz_next(&d, y);
+    }
+}
+
+/******************************************************************************
+** Function name:       hz_draw
+** Descriptions:        Finestra sulla parte visibile; ogni riga decompressa viene
+**                      espansa nei 16 pixel e scritta con un solo LCD_PushPixels.
+**                      Le righe sotto il clip non si decomprimono.
+******************************************************************************/
+void hz_draw( uint16_t Xpos, uint16_t Ypos, const HZ_Font *f, int16_t glyph, uint16_t fg, uint16_t bg )
+{
+    const LCD_Rect *clip = LCD_GetClip();
+    HZ_Dec   d;
+    uint16_t px[HZ_SIZE], bits, mask;
+    int16_t  x0, y0, x1, y1;
+    uint8_t  y, i;
+
+    if( glyph < 0 ){
+        return;
+    }
+    x0 = (clip->x0 > Xpos) ? clip->x0 - Xpos : 0;
+    y0 = (clip->y0 > Ypos) ? clip->y0 - Ypos : 0;
+    x1 = (clip->x1 < Xpos + HZ_SIZE - 1) ? clip->x1 - Xpos : HZ_SIZE - 1;
+    y1 = (clip->y1 < Ypos + HZ_SIZE - 1) ? clip->y1 - Ypos : HZ_SIZE - 1;
+    if( x1 < x0 || y1 < y0 ){
+        return;
+    }
+
+    hz_begin(&d, f, glyph);
+    LCD_BeginPixels(Xpos + x0, Ypos + y0, x1 - x0 + 1, y1 - y0 + 1);
+    for( y = 0; y <= y1; y++ ){
+        bits = hz_next(&d, y);
+        if( y < y0 ){
+            continue;
+        }
+        for( i = 0, mask = 0x8000; i < HZ_SIZE; i++, mask >>= 1 ){
+            px[i] = (bits & mask) ? fg : bg;
+        }
+        LCD_PushPixels(&px[x0], x1 - x0 + 1);
+    }
+    LCD_EndPixels();
+}
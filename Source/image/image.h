@@ -0,0 +1,50 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           image.h
+** Descriptions:        Immagini RGB565 compresse in flash (formato "Q5", simile a QOI) decodificate
+**                      direttamente nella finestra GRAM, senza buffer dell'immagine intera.
+**                      I file si generano dai PPM con Host/img2c.cpp.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __IMAGE_H
+#define __IMAGE_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+#include "../GLCD/GLCD.h"
+
+/* Formato (byte, interi little endian):
+ *   'Q' '5' w(2) h(2) npal(1) palette(npal * 2) dati
+ * Il decoder tiene l'ultimo pixel e una tabella di 64 colori recenti, precaricata
+ * con la palette se npal > 0 (in quel caso i dati usano solo INDEX e RUN).
+ *   00iiiiii              INDEX  pixel = tab[i]
+ *   01rrggbb              DIFF   r, g, b += -2..1 (campo - 2)
+ *   10gggggg rrrrbbbb     LUMA   g += -32..31, r e b += -8..7 (campo - 32 / - 8)
+ *   11nnnnnn (< 0xFE)     RUN    n + 1 ripetizioni dell'ultimo pixel (1..62)
+ *   0xFE hi lo            RGB    pixel RGB565
+ *   0xFF hi lo            RUN    hi * 256 + lo + 1 ripetizioni (1..65536)
+ * Dopo DIFF, LUMA e RGB il pixel entra in tab[IMAGE_HASH(pixel)].
+ * I pixel seguono le righe dall'alto in basso; all'inizio l'ultimo pixel e' nero. */
+#define IMAGE_HEADER        7
+#define IMAGE_TAB           64
+#define IMAGE_HASH(p)       ( (((p) >> 11) * 3 + (((p) >> 5) & 0x3f) * 5 + ((p) & 0x1f) * 7) & (IMAGE_TAB - 1) )
+
+#define IMAGE_OP_INDEX      0x00
+#define IMAGE_OP_DIFF       0x40
+#define IMAGE_OP_LUMA       0x80
+#define IMAGE_OP_RUN        0xC0
+#define IMAGE_OP_RGB        0xFE
+#define IMAGE_OP_RUN16      0xFF
+
+/* Immagine di prova 64x64 (img_test.c), usata dal benchmark e dalla demo su PC */
+extern const uint8_t img_test[];
+
+/* Dimensioni dell'immagine (0 se img non e' nel formato Q5) */
+extern uint16_t image_width( const uint8_t *img );
+extern uint16_t image_height( const uint8_t *img );
+
+/* Disegna l'immagine con l'angolo in alto a sinistra in (Xpos, Ypos), tagliata al
+ * rettangolo di clip del GLCD (LCD_PushClip; di default lo schermo). */
+extern void image_draw( uint16_t Xpos, uint16_t Ypos, const uint8_t *img );
+
+#endif /* end __IMAGE_H */
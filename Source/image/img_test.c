@@ -0,0 +1,110 @@
+/* Generato da Host/img2c.cpp: img_test.ppm, 64x64, senza palette, 8192 -> 1642 byte */
+#include <stdint.h>
+
+extern const uint8_t img_test[];
+
+const uint8_t img_test[1642] = {
+    0x51, 0x35, 0x40, 0x00, 0x40, 0x00, 0x00, 0xfe, 0x29, 0xf4, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e,
+    0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e,
+    0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x26, 0xc2, 0x2b, 0xc2, 0x30, 0xc2, 0x35,
+    0xc2, 0x3a, 0xc2, 0x3f, 0xc2, 0x04, 0xc2, 0x09, 0xc2, 0x0e, 0xc2, 0x13, 0xc2, 0x18, 0xc2, 0x1d,
+    0xc2, 0x22, 0xc2, 0x27, 0xc2, 0x2c, 0xc2, 0x31, 0xc2, 0x26, 0xc2, 0x2b, 0xc2, 0x30, 0xc2, 0x35,
+    0xc2, 0x3a, 0xc2, 0x3f, 0xc2, 0x04, 0xc2, 0x09, 0xc2, 0x0e, 0xc2, 0x13, 0xc2, 0x18, 0xc2, 0x1d,
+    0xc2, 0x22, 0xc2, 0x27, 0xc2, 0x2c, 0xc2, 0x31, 0xc2, 0x26, 0xc2, 0x2b, 0xc2, 0x30, 0xc2, 0x35,
+    0xc2, 0x3a, 0xc2, 0x3f, 0xc2, 0x04, 0xc2, 0x09, 0xc2, 0x0e, 0xc2, 0x13, 0xc2, 0x18, 0xc2, 0x1d,
+    0xc2, 0x22, 0xc2, 0x27, 0xc2, 0x2c, 0xc2, 0x31, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2,
+    0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2,
+    0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x29, 0xc2, 0x2e, 0xc2, 0x33, 0xc2,
+    0x38, 0xc2, 0x3d, 0xc2, 0x02, 0xc2, 0x07, 0xc2, 0x0c, 0xc2, 0x11, 0xc2, 0x16, 0xc2, 0x1b, 0xc2,
+    0x20, 0xc2, 0x25, 0xc2, 0x2a, 0xc2, 0x2f, 0xc2, 0x34, 0xc2, 0x29, 0xc2, 0x2e, 0xc2, 0x33, 0xc2,
+    0x38, 0xc2, 0x3d, 0xc2, 0x02, 0xc2, 0x07, 0xc2, 0x0c, 0xc2, 0x11, 0xc2, 0x16, 0xc2, 0x1b, 0xc2,
+    0x20, 0xc2, 0x25, 0xc2, 0x2a, 0xc2, 0x2f, 0xc2, 0x34, 0xc2, 0x29, 0xc2, 0x2e, 0xc2, 0x33, 0xc2,
+    0x38, 0xc2, 0x3d, 0xc2, 0x02, 0xc2, 0x07, 0xc2, 0x0c, 0xc2, 0x11, 0xc2, 0x16, 0xc2, 0x1b, 0xc2,
+    0x20, 0xc2, 0x25, 0xc2, 0x2a, 0xc2, 0x2f, 0xc2, 0x34, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e,
+    0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0xfe, 0x00, 0x00, 0xfe, 0x3a,
+    0xf4, 0xc1, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2,
+    0x2c, 0xc2, 0x31, 0xc2, 0x36, 0xc2, 0x3b, 0xc2, 0x6e, 0xc2, 0x05, 0xc2, 0x0a, 0xc0, 0xfe, 0x00,
+    0x00, 0xcb, 0x19, 0x1e, 0xc2, 0x23, 0xc2, 0x28, 0xc2, 0x2d, 0xc2, 0x32, 0xc2, 0x37, 0xc2, 0x2c,
+    0xc2, 0x31, 0xc2, 0x36, 0xc2, 0x3b, 0xc2, 0x6e, 0xc2, 0x05, 0xc1, 0xfe, 0x00, 0x00, 0xc7, 0x92,
+    0x78, 0x00, 0xc7, 0x1e, 0xc0, 0x23, 0xc2, 0x28, 0xc2, 0x2d, 0xc2, 0x32, 0xc2, 0x37, 0xc2, 0x2c,
+    0xc2, 0x31, 0xc2, 0x36, 0xc2, 0x3b, 0xc2, 0x6e, 0xc2, 0x05, 0xfe, 0x00, 0x00, 0xc3, 0x17, 0xcb,
+    0x00, 0xc3, 0x23, 0xc2, 0x28, 0xc2, 0x2d, 0xc2, 0x32, 0xc2, 0x37, 0xc2, 0x91, 0x98, 0xc2, 0x6e,
+    0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x00, 0xc2, 0x17, 0xcf, 0x00, 0xc2, 0xfe, 0x43, 0x54,
+    0xc1, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x2f, 0xc2, 0x34, 0xc2, 0x39, 0xc2, 0x3e,
+    0xc2, 0x03, 0xc1, 0x00, 0xc1, 0x17, 0xd3, 0x00, 0xc1, 0x26, 0xc0, 0x2b, 0xc2, 0x30, 0xc2, 0x35,
+    0xc2, 0x3a, 0xc2, 0x2f, 0xc2, 0x34, 0xc2, 0x39, 0xc2, 0x3e, 0xc2, 0x03, 0x00, 0xc1, 0x17, 0xd7,
+    0x00, 0xc1, 0x2b, 0xc2, 0x30, 0xc2, 0x35, 0xc2, 0x3a, 0xc2, 0x2f, 0xc2, 0x34, 0xc2, 0x39, 0xc2,
+    0x3e, 0xc2, 0x00, 0xc1, 0x17, 0xd9, 0x00, 0xc1, 0x2b, 0xc1, 0x30, 0xc2, 0x35, 0xc2, 0x3a, 0xc2,
+    0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x00, 0xc0, 0x17, 0xdb, 0x00, 0xc0, 0xfe,
+    0x4b, 0x74, 0xc1, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x32, 0xc2, 0x37, 0xc2, 0x3c, 0xc2, 0x01,
+    0xc1, 0x00, 0xc0, 0x17, 0xdd, 0x00, 0xc0, 0x2e, 0xc0, 0x33, 0xc2, 0x38, 0xc2, 0x3d, 0xc2, 0x32,
+    0xc2, 0x37, 0xc2, 0x3c, 0xc2, 0x01, 0xc0, 0x00, 0xc0, 0x17, 0xdf, 0x00, 0xc0, 0x2e, 0x33, 0xc2,
+    0x38, 0xc2, 0x3d, 0xc2, 0x32, 0xc2, 0x37, 0xc2, 0x3c, 0xc2, 0x01, 0x00, 0xc1, 0x17, 0xdf, 0x00,
+    0xc1, 0x33, 0xc2, 0x38, 0xc2, 0x3d, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0x00,
+    0xc0, 0x17, 0xe1, 0x00, 0xc0, 0xfe, 0x53, 0x94, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x35, 0xc2, 0x3a,
+    0xc2, 0x3f, 0xc2, 0xfe, 0x00, 0x00, 0xc1, 0x17, 0xe1, 0x00, 0xc1, 0x36, 0xc1, 0x3b, 0xc2, 0x6e,
+    0xc2, 0x35, 0xc2, 0x3a, 0xc2, 0x3f, 0xc2, 0xfe, 0x00, 0x00, 0xc0, 0x17, 0xe3, 0x00, 0xc0, 0x36,
+    0xc1, 0x3b, 0xc2, 0x6e, 0xc2, 0x35, 0xc2, 0x3a, 0xc2, 0x3f, 0xc2, 0xfe, 0x00, 0x00, 0xc0, 0x17,
+    0xe3, 0x00, 0xc0, 0x36, 0xc1, 0x3b, 0xc2, 0x6e, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc1,
+    0xfe, 0x00, 0x00, 0xc0, 0x17, 0xe5, 0x00, 0xc0, 0xfe, 0x5b, 0x94, 0xc0, 0x6e, 0xc2, 0x6e, 0xc2,
+    0x38, 0xc2, 0x3d, 0xc2, 0x02, 0xc1, 0x00, 0xc0, 0x17, 0xe5, 0x00, 0xc0, 0x39, 0xc0, 0x3e, 0xc2,
+    0x03, 0xc2, 0x38, 0xc2, 0x3d, 0xc2, 0x02, 0xc1, 0x00, 0xc0, 0x17, 0xe5, 0x00, 0xc0, 0x39, 0xc0,
+    0x3e, 0xc2, 0x03, 0xc2, 0x38, 0xc2, 0x3d, 0xc2, 0x02, 0xc1, 0x00, 0xc0, 0x17, 0xe5, 0x00, 0xc0,
+    0x39, 0xc0, 0x3e, 0xc2, 0x03, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc1, 0xfe, 0x00, 0x00,
+    0xc0, 0x17, 0xe5, 0x00, 0xc0, 0xfe, 0x63, 0x94, 0xc0, 0x6e, 0xc2, 0x6e, 0xc2, 0x3b, 0xc2, 0x6e,
+    0xc2, 0x05, 0xc1, 0xfe, 0x00, 0x00, 0xc0, 0x17, 0xe5, 0x00, 0xc0, 0x3c, 0xc0, 0x01, 0xc2, 0x06,
+    0xc2, 0x3b, 0xc2, 0x6e, 0xc2, 0x05, 0xc0, 0xfe, 0x00, 0x00, 0xc0, 0x17, 0xe7, 0x00, 0xc0, 0x3c,
+    0x01, 0xc2, 0x06, 0xc2, 0x3b, 0xc2, 0x6e, 0xc2, 0x05, 0xc1, 0xfe, 0x00, 0x00, 0xc0, 0x17, 0xe5,
+    0x00, 0xc0, 0x3c, 0xc0, 0x01, 0xc2, 0x06, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc1, 0x00,
+    0xc0, 0x17, 0xe5, 0x00, 0xc0, 0xfe, 0x6b, 0x94, 0xc0, 0x6e, 0xc2, 0x6e, 0xc2, 0x3e, 0xc2, 0x03,
+    0xc2, 0x08, 0xc1, 0x00, 0xc0, 0x17, 0xe5, 0x00, 0xc0, 0x3f, 0xc0, 0x04, 0xc2, 0x09, 0xc2, 0x3e,
+    0xc2, 0x03, 0xc2, 0x08, 0xc1, 0x00, 0xc0, 0x17, 0xe5, 0x00, 0xc0, 0x3f, 0xc0, 0x04, 0xc2, 0x09,
+    0xc2, 0x3e, 0xc2, 0x03, 0xc2, 0x08, 0xc1, 0x00, 0xc0, 0x17, 0xe5, 0x00, 0xc0, 0x3f, 0xc0, 0x04,
+    0xc2, 0x09, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc1, 0x00, 0xc0, 0x17, 0xe5, 0x00, 0xc0,
+    0xfe, 0x73, 0x94, 0xc0, 0x6e, 0xc2, 0x6e, 0xc2, 0x01, 0xc2, 0x06, 0xc2, 0x0b, 0xc2, 0x00, 0xc0,
+    0x17, 0xe3, 0x00, 0xc0, 0x02, 0xc1, 0x07, 0xc2, 0x0c, 0xc2, 0x01, 0xc2, 0x06, 0xc2, 0x0b, 0xc2,
+    0x00, 0xc0, 0x17, 0xe3, 0x00, 0xc0, 0x02, 0xc1, 0x07, 0xc2, 0x0c, 0xc2, 0x01, 0xc2, 0x06, 0xc2,
+    0x0b, 0xc2, 0x00, 0xc1, 0x17, 0xe1, 0x00, 0xc1, 0x02, 0xc1, 0x07, 0xc2, 0x0c, 0xc2, 0x91, 0x98,
+    0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0x00, 0xc0, 0x17, 0xe1, 0x00, 0xc0, 0xfe, 0x7b, 0x94, 0xc2,
+    0x6e, 0xc2, 0x6e, 0xc2, 0x04, 0xc2, 0x09, 0xc2, 0x0e, 0xc2, 0x13, 0x00, 0xc1, 0x17, 0xdf, 0x00,
+    0xc1, 0x05, 0xc2, 0x0a, 0xc2, 0x0f, 0xc2, 0x04, 0xc2, 0x09, 0xc2, 0x0e, 0xc2, 0x13, 0xc0, 0x00,
+    0xc0, 0x17, 0xdf, 0x00, 0xc0, 0xfe, 0x7b, 0x74, 0x05, 0xc2, 0x0a, 0xc2, 0x0f, 0xc2, 0x04, 0xc2,
+    0x09, 0xc2, 0x0e, 0xc2, 0x13, 0xc1, 0xfe, 0x00, 0x00, 0xc0, 0x17, 0xdd, 0x00, 0xc0, 0xfe, 0x7b,
+    0x74, 0xc0, 0x05, 0xc2, 0x0a, 0xc2, 0x0f, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e,
+    0xc2, 0xfe, 0x00, 0x00, 0xc0, 0x17, 0xdb, 0x00, 0xc0, 0xfe, 0x83, 0x74, 0xc1, 0x6e, 0xc2, 0x6e,
+    0xc2, 0x6e, 0xc2, 0x07, 0xc2, 0x0c, 0xc2, 0x11, 0xc2, 0x16, 0xc2, 0x00, 0xc1, 0x17, 0xd9, 0x00,
+    0xc1, 0x03, 0xc1, 0x08, 0xc2, 0x0d, 0xc2, 0x12, 0xc2, 0x07, 0xc2, 0x0c, 0xc2, 0x11, 0xc2, 0x16,
+    0xc2, 0x6e, 0x00, 0xc1, 0x17, 0xd7, 0x00, 0xc1, 0x03, 0xc2, 0x08, 0xc2, 0x0d, 0xc2, 0x12, 0xc2,
+    0x07, 0xc2, 0x0c, 0xc2, 0x11, 0xc2, 0x16, 0xc2, 0x1b, 0xc1, 0x00, 0xc1, 0x17, 0xd3, 0x00, 0xc1,
+    0xfe, 0x83, 0x54, 0xc0, 0x03, 0xc2, 0x08, 0xc2, 0x0d, 0xc2, 0x12, 0xc2, 0x91, 0x98, 0xc2, 0x6e,
+    0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x00, 0xc2, 0x17, 0xcf, 0x00, 0xc2, 0xfe, 0x8b, 0x54,
+    0xc1, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x0a, 0xc2, 0x0f, 0xc2, 0x14, 0xc2, 0x19,
+    0xc2, 0x1e, 0xc2, 0x6e, 0x00, 0xc3, 0x17, 0xcb, 0x00, 0xc3, 0x01, 0xc2, 0x06, 0xc2, 0x0b, 0xc2,
+    0x10, 0xc2, 0x15, 0xc2, 0x0a, 0xc2, 0x0f, 0xc2, 0x14, 0xc2, 0x19, 0xc2, 0x1e, 0xc2, 0x23, 0xc1,
+    0x00, 0x55, 0xce, 0x00, 0xc0, 0xfe, 0x8b, 0x34, 0xc0, 0x01, 0xc2, 0x06, 0xc2, 0x0b, 0xc2, 0x10,
+    0xc2, 0x15, 0xc2, 0x0a, 0xc2, 0x0f, 0xc2, 0x14, 0xc2, 0x19, 0xc2, 0x1e, 0xc2, 0x23, 0xc2, 0x31,
+    0xce, 0x3c, 0xc2, 0x01, 0xc2, 0x06, 0xc2, 0x0b, 0xc2, 0x10, 0xc2, 0x15, 0xc2, 0x91, 0x98, 0xc2,
+    0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x31, 0xce, 0xfe, 0x93, 0x34, 0xc2,
+    0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x0d, 0xc2, 0x12, 0xc2, 0x17, 0xc2,
+    0x1c, 0xc2, 0x21, 0xc2, 0x26, 0xc2, 0x31, 0xce, 0x3f, 0xc2, 0x04, 0xc2, 0x09, 0xc2, 0x0e, 0xc2,
+    0x13, 0xc2, 0x18, 0xc2, 0x0d, 0xc2, 0x12, 0xc2, 0x17, 0xc2, 0x1c, 0xc2, 0x21, 0xc2, 0x26, 0xc2,
+    0x31, 0xce, 0x3f, 0xc2, 0x04, 0xc2, 0x09, 0xc2, 0x0e, 0xc2, 0x13, 0xc2, 0x18, 0xc2, 0x0d, 0xc2,
+    0x12, 0xc2, 0x17, 0xc2, 0x1c, 0xc2, 0x21, 0xc2, 0x26, 0xc2, 0x31, 0xce, 0x3f, 0xc2, 0x04, 0xc2,
+    0x09, 0xc2, 0x0e, 0xc2, 0x13, 0xc2, 0x18, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e,
+    0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e,
+    0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x10, 0xc2, 0x15, 0xc2, 0x1a, 0xc2, 0x1f,
+    0xc2, 0x24, 0xc2, 0x29, 0xc2, 0x2e, 0xc2, 0x33, 0xc2, 0x38, 0xc2, 0x3d, 0xc2, 0x02, 0xc2, 0x07,
+    0xc2, 0x0c, 0xc2, 0x11, 0xc2, 0x16, 0xc2, 0x1b, 0xc2, 0x10, 0xc2, 0x15, 0xc2, 0x1a, 0xc2, 0x1f,
+    0xc2, 0x24, 0xc2, 0x29, 0xc2, 0x2e, 0xc2, 0x33, 0xc2, 0x38, 0xc2, 0x3d, 0xc2, 0x02, 0xc2, 0x07,
+    0xc2, 0x0c, 0xc2, 0x11, 0xc2, 0x16, 0xc2, 0x1b, 0xc2, 0x10, 0xc2, 0x15, 0xc2, 0x1a, 0xc2, 0x1f,
+    0xc2, 0x24, 0xc2, 0x29, 0xc2, 0x2e, 0xc2, 0x33, 0xc2, 0x38, 0xc2, 0x3d, 0xc2, 0x02, 0xc2, 0x07,
+    0xc2, 0x0c, 0xc2, 0x11, 0xc2, 0x16, 0xc2, 0x1b, 0xc2, 0x91, 0x98, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2,
+    0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2,
+    0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x6e, 0xc2, 0x13, 0xc2, 0x18, 0xc2, 0x1d, 0xc2,
+    0x22, 0xc2, 0x27, 0xc2, 0x2c, 0xc2, 0x31, 0xc2, 0x36, 0xc2, 0x3b, 0xc2, 0x00, 0xc2, 0x05, 0xc2,
+    0x0a, 0xc2, 0x0f, 0xc2, 0x14, 0xc2, 0x19, 0xc2, 0x1e, 0xc2, 0x13, 0xc2, 0x18, 0xc2, 0x1d, 0xc2,
+    0x22, 0xc2, 0x27, 0xc2, 0x2c, 0xc2, 0x31, 0xc2, 0x36, 0xc2, 0x3b, 0xc2, 0x00, 0xc2, 0x05, 0xc2,
+    0x0a, 0xc2, 0x0f, 0xc2, 0x14, 0xc2, 0x19, 0xc2, 0x1e, 0xc2, 0x13, 0xc2, 0x18, 0xc2, 0x1d, 0xc2,
+    0x22, 0xc2, 0x27, 0xc2, 0x2c, 0xc2, 0x31, 0xc2, 0x36, 0xc2, 0x3b, 0xc2, 0x00, 0xc2, 0x05, 0xc2,
+    0x0a, 0xc2, 0x0f, 0xc2, 0x14, 0xc2, 0x19, 0xc2, 0x1e, 0xc2,
+};
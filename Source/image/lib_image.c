@@ -0,0 +1,154 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_image.c
+** Descriptions:        Decoder Q5 a flusso: ogni codice produce un colore e un numero di ripetizioni,
+** che vanno direttamente sul bus (le ripetizioni con LCD_PushColor, che pulsa solo WR).
+** Lo stato e' l'ultimo pixel e la tabella di 64 colori: nessun buffer dell'immagine.
+** Correlated files:    image.h, GLCD.c (LCD_BeginPixels/LCD_PushColor), Host/img2c.cpp
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include "image.h"
+
+typedef struct {
+    const uint8_t *src;             /* prossimo codice */
+    uint16_t       px;              /* ultimo pixel */
+    uint16_t       tab[IMAGE_TAB];
+} IMG_Dec;
+
+/******************************************************************************
+** Function name:       image_width
+** Descriptions:        Larghezza dall'intestazione.
+******************************************************************************/
+uint16_t image_width( const uint8_t *img )
+{
+    if( img[0] != 'Q' || img[1] != '5' ){
+        return 0;
+    }
+    return img[2] | (img[3] << 8);
+}
+
+/******************************************************************************
+** Function name:       image_height
+** Descriptions:        Altezza dall'intestazione.
+******************************************************************************/
+uint16_t image_height( const uint8_t *img )
+{
+    if( img[0] != 'Q' || img[1] != '5' ){
+        return 0;
+    }
+    return img[4] | (img[5] << 8);
+}
+
+/******************************************************************************
+** Function name:       img_next
+** Descriptions:        Decodifica un codice: lascia il colore in d->px e ritorna
+**                      quante volte va scritto.
+******************************************************************************/
+static uint32_t img_next( IMG_Dec *d )
+{
+    uint8_t  op = *d->src++;
+    uint16_t p  = d->px;
+    uint8_t  b;
+
+    if( op < IMAGE_OP_DIFF ){
+        d->px = d->tab[op];
+        return 1;
+    }
+    if( op < IMAGE_OP_LUMA ){
+        p = (((p >> 11) + ((op >> 4) & 3) - 2) & 0x1f) << 11
+          | ((((p >> 5) & 0x3f) + ((op >> 2) & 3) - 2) & 0x3f) << 5
+          | (((p & 0x1f) + (op & 3) - 2) & 0x1f);
+    }else if( op < IMAGE_OP_RUN ){
+        b = *d->src++;
+        p = (((p >> 11) + (b >> 4) - 8) & 0x1f) << 11
+          | ((((p >> 5) & 0x3f) + (op & 0x3f) - 32) & 0x3f) << 5
+          | (((p & 0x1f) + (b & 0x0f) - 8) & 0x1f);
+    }else if( op < IMAGE_OP_RGB ){
+        return (op & 0x3f) + 1;
+    }else if( op == IMAGE_OP_RGB ){
+        p = (d->src[0] << 8) | d->src[1];
+        d->src += 2;
+    }else{                          /* RUN16 */
+        d->src += 2;
+        return ((d->src[-2] << 8) | d->src[-1]) + 1;
+    }
+    d->px = p;
+    d->tab[IMAGE_HASH(p)] = p;
+    return 1;
+}
+
+/******************************************************************************
+** Function name:       image_draw
+** Descriptions:        Taglio fatto una volta sola col rettangolo di clip del GLCD:
+**                      una finestra per la parte visibile, le righe sopra si
+**                      decodificano senza scriverle, quelle sotto non si decodificano.
+**                      Se l'immagine entra in larghezza una ripetizione attraversa
+**                      le righe con un solo LCD_PushColor; altrimenti ogni tratto
+**                      viene ridotto alle colonne visibili.
+******************************************************************************/
+void image_draw( uint16_t Xpos, uint16_t Ypos, const uint8_t *img )
+{
+    IMG_Dec  d;
+    const LCD_Rect *clip = LCD_GetClip();
+    uint16_t w = image_width(img), h = image_height(img);
+    int32_t  x0, y0, x1, y1;            /* parte visibile, in coordinate dell'immagine */
+    uint32_t n, k, left, skip, col = 0, row = 0;
+    uint8_t  i, npal;
+
+    x0 = (clip->x0 > Xpos) ? clip->x0 - Xpos : 0;
+    y0 = (clip->y0 > Ypos) ? clip->y0 - Ypos : 0;
+    x1 = (clip->x1 < Xpos + w - 1) ? clip->x1 - Xpos : w - 1;
+    y1 = (clip->y1 < Ypos + h - 1) ? clip->y1 - Ypos : h - 1;
+    if( w == 0 || h == 0 || x1 < x0 || y1 < y0 ){
+        return;
+    }
+
+    npal = img[6];
+    for( i = 0; i < IMAGE_TAB; i++ ){
+        d.tab[i] = (i < npal) ? img[IMAGE_HEADER + 2 * i] | (img[IMAGE_HEADER + 2 * i + 1] << 8) : 0;
+    }
+    d.src = img + IMAGE_HEADER + 2 * npal;
+    d.px  = 0;
+
+    LCD_BeginPixels(Xpos + x0, Ypos + y0, x1 - x0 + 1, y1 - y0 + 1);
+    if( x0 == 0 && x1 == w - 1 ){
+        skip = (uint32_t)y0 * w;
+        left = (uint32_t)w * (y1 - y0 + 1);
+        while( left != 0 ){
+            n = img_next(&d);
+            if( skip != 0 ){
+                k = (n < skip) ? n : skip;
+                skip -= k;
+                n    -= k;
+            }
+            if( n > left ){
+                n = left;
+            }
+            LCD_PushColor(d.px, n);
+            left -= n;
+        }
+        LCD_EndPixels();
+        return;
+    }
+    while( row <= (uint32_t)y1 ){
+        n = img_next(&d);
+        while( n != 0 && row <= (uint32_t)y1 ){
+            k = w - col;                /* pixel che restano nella riga */
+            if( k > n ){
+                k = n;
+            }
+            if( row >= (uint32_t)y0 && col + k > (uint32_t)x0 && col <= (uint32_t)x1 ){
+                LCD_PushColor(d.px, ((col + k - 1 < (uint32_t)x1) ? col + k - 1 : x1)
+                                    - ((col > (uint32_t)x0) ? col : x0) + 1);
+            }
+            col += k;
+            n   -= k;
+            if( col == w ){
+                col = 0;
+                row++;
+            }
+        }
+    }
+    LCD_EndPixels();
+}
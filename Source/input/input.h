@@ -0,0 +1,65 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           input.h
+** Descriptions:        Motore unico di ingresso: debounce parallelo di pulsanti e joystick con eventi
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __INPUT_H
+#define __INPUT_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+
+/* INGRESSI
+ * L'indice e' anche la posizione del bit nel campione costruito da INPUT_SAMPLE().
+ */
+enum {
+    INPUT_INT0 = 0,     /* P2.10 */
+    INPUT_KEY1,         /* P2.11 */
+    INPUT_KEY2,         /* P2.12 */
+    INPUT_J_SELECT,     /* P1.25 */
+    INPUT_J_DOWN,       /* P1.26 */
+    INPUT_J_LEFT,       /* P1.27 */
+    INPUT_J_RIGHT,      /* P1.28 */
+    INPUT_J_UP,         /* P1.29 */
+    INPUT_NUM
+};
+
+/* EVENTI */
+enum {
+    INPUT_PRESS = 0,    /* pressione confermata (2 campioni uguali) */
+    INPUT_RELEASE,      /* rilascio confermato */
+    INPUT_LONG,         /* tenuto premuto per long_ticks */
+    INPUT_REPEAT        /* autorepeat mentre e' tenuto premuto */
+};
+
+/* Configurazione di un ingresso (tempi in tick del RIT, 0 = disabilitato) */
+typedef struct {
+    uint16_t long_ticks;    /* dopo quanti tick generare INPUT_LONG */
+    uint16_t repeat_start;  /* tick prima del primo INPUT_REPEAT */
+    uint16_t repeat_every;  /* periodo dell'autorepeat */
+} INPUT_Config;
+
+/* Un'unica lettura di P2 e P1: bit = 1 se l'ingresso e' premuto (i tasti chiudono a massa).
+ * P2.10..12 -> bit 0..2, P1.25..29 -> bit 3..7 */
+#define INPUT_SAMPLE()  ((uint8_t)~( ((LPC_GPIO2->FIOPIN >> 10) & 0x07) | \
+                                     ((LPC_GPIO1->FIOPIN >> 22) & 0xF8) ))
+
+/* Da chiamare a ogni tick del RIT: campiona, fa il debounce e genera gli eventi */
+extern void input_scan( void );
+
+/* Stato stabile di tutti gli ingressi (bit = INPUT_xxx, 1 = premuto) */
+extern uint8_t input_get_state( void );
+
+/* 1 se un ingresso e' premuto o in debounce: il RIT deve restare periodico */
+extern uint8_t input_busy( void );
+
+/* Il joystick (P1) non genera interrupt: in tickless il RIT lo campiona
+ * comunque almeno ogni INPUT_IDLE_POLL tick (4 = 200ms con RIT = 50ms).
+ * 0 = nessun limite, se il joystick non si usa. */
+#define INPUT_IDLE_POLL     4
+
+/* Callback degli eventi, chiamata nel contesto del RIT (implementata in IRQ_RIT.c) */
+extern void input_event( uint8_t id, uint8_t event );
+
+#endif /* end __INPUT_H */
@@ -0,0 +1,125 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_input.c
+** Descriptions:        Debounce parallelo (contatori verticali) di INT0, KEY1, KEY2 e joystick.
+** Gli eventi (press, release, long press, autorepeat) sono generati da un'unica tabella.
+** Correlated files:    input.h, IRQ_RIT.c, IRQ_button.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include "input.h"
+
+/* Bandiere impostate dagli handler EINT (IRQ_button.c) */
+extern volatile int down_0;
+extern volatile int down_1;
+extern volatile int down_2;
+
+/* TABELLA DI CONFIGURAZIONE
+ * Una riga per ingresso, nello stesso ordine dell'enum in input.h.
+ * Con RIT = 50ms: 20 tick = 1 secondo, 4 tick = 200ms.
+ * Per aggiungere un ingresso: enum + riga qui + bit in INPUT_SAMPLE().
+ */
+static const INPUT_Config input_config[INPUT_NUM] = {
+    /* long   repeat_start   repeat_every */
+    {  20,    0,             0  },      /* INPUT_INT0     */
+    {  20,    0,             0  },      /* INPUT_KEY1     */
+    {  20,    0,             0  },      /* INPUT_KEY2     */
+    {  20,    0,             0  },      /* INPUT_J_SELECT */
+    {  0,     8,             4  },      /* INPUT_J_DOWN   */
+    {  0,     8,             4  },      /* INPUT_J_LEFT   */
+    {  0,     8,             4  },      /* INPUT_J_RIGHT  */
+    {  0,     8,             4  },      /* INPUT_J_UP     */
+};
+
+static uint8_t  input_state;                /* stato stabile, 1 = premuto */
+static uint8_t  input_ct;                   /* contatore verticale: 1 = gia' diverso al tick precedente */
+static uint16_t input_held[INPUT_NUM];      /* tick trascorsi dalla pressione */
+
+static volatile int * const input_down[3] = { &down_0, &down_1, &down_2 };
+
+/******************************************************************************
+** Function name:       input_get_state
+** Descriptions:        Ritorna lo stato stabile di tutti gli ingressi.
+******************************************************************************/
+uint8_t input_get_state( void )
+{
+    return input_state;
+}
+
+/******************************************************************************
+** Function name:       input_busy
+** Descriptions:        Vero se c'e' un ingresso premuto, un debounce in corso
+**                      o un pulsante EINT non ancora riabilitato.
+******************************************************************************/
+uint8_t input_busy( void )
+{
+    return (input_state | input_ct | INPUT_SAMPLE()) != 0 ||
+           down_0 != 0 || down_1 != 0 || down_2 != 0;
+}
+
+/******************************************************************************
+** Function name:       input_scan
+** Descriptions:        Campiona P1 e P2 una volta e fa il debounce di tutti gli
+**                      ingressi in parallelo, un bit per ingresso.
+**                      Un bit cambia stato dopo 2 campioni consecutivi diversi
+**                      dallo stato stabile (come il vecchio "case 2").
+******************************************************************************/
+void input_scan( void )
+{
+    const INPUT_Config *cfg;
+    uint8_t raw, delta, toggle, pressed, released, pending;
+    uint8_t id, bit;
+    uint16_t held;
+
+    raw = INPUT_SAMPLE();
+
+    /* Contatori verticali: le stesse operazioni valgono per tutti gli 8 bit */
+    delta        = raw ^ input_state;
+    toggle       = delta & input_ct;
+    input_ct     = delta & ~input_ct;
+    input_state ^= toggle;
+
+    pressed  = toggle & input_state;
+    released = toggle & ~input_state;
+
+    /* Eventi: si visitano solo gli ingressi premuti o appena rilasciati */
+    pending = input_state | released;
+    for( id = 0, bit = 1; pending != 0; id++, bit <<= 1 ){
+        if( (pending & bit) == 0 ){
+            continue;
+        }
+        pending &= ~bit;
+
+        if( pressed & bit ){
+            input_held[id] = 0;
+            input_event(id, INPUT_PRESS);
+        }
+        else if( released & bit ){
+            input_event(id, INPUT_RELEASE);
+        }
+        else {
+            held = input_held[id];
+            if( held < 0xFFFF ){
+                input_held[id] = ++held;
+            }
+            cfg = &input_config[id];
+            if( held == cfg->long_ticks ){
+                input_event(id, INPUT_LONG);
+            }
+            if( cfg->repeat_every != 0 && held >= cfg->repeat_start &&
+                ((held - cfg->repeat_start) % cfg->repeat_every) == 0 ){
+                input_event(id, INPUT_REPEAT);
+            }
+        }
+    }
+
+    /* PULSANTI EINT: l'handler ha disabilitato l'interrupt e messo il pin in GPIO.
+     * Si riabilita quando il tasto e' rilasciato e stabile (anche se era solo un rimbalzo). */
+    for( id = INPUT_INT0, bit = 1; id <= INPUT_KEY2; id++, bit <<= 1 ){
+        if( *input_down[id] != 0 && ((input_state | raw) & bit) == 0 ){
+            *input_down[id] = 0;
+            NVIC_EnableIRQ((IRQn_Type)(EINT0_IRQn + id));
+            LPC_PINCON->PINSEL4 |= (1 << (20 + 2 * id));    /* ritorna in modalita' EINT */
+        }
+    }
+}
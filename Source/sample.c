@@ -16,7 +16,21 @@
 #include "led/led.h"
 #include "button/button.h"
 #include "joystick/joystick.h"
+#include "input/input.h"
+#include "event/event.h"
+#include "console/console.h"
+#include "fb/fb.h"
+#include "scene/scene.h"
+#include "sprite/sprite.h"
+#include "image/image.h"
+#include "hzfont/hzfont.h"
+#include "text/text.h"
+#include "font/font.h"
+#include "gcache/gcache.h"
 //#include "adc/adc.h"
+#ifdef GLCD_BENCH
+#include "bench/bench.h"
+#endif
 
 #ifdef SIMULATOR
 extern uint8_t ScaleFlag; 
@@ -33,9 +47,22 @@ extern uint8_t ScaleFlag;
 
 int main(void)
 {
+    EVENT_t ev;
+
     /* 1. SYSTEM INIT: Configura il Clock (PLL) a 100MHz (di solito) */
     SystemInit(); 
 
+    /* 2. CODA EVENTI: timestamp in cicli CPU (DWT). Gli interrupt accodano, il while(1) svuota. */
+    event_init();
+
+#ifdef GLCD_BENCH
+    /* TARGET GLCD_BENCH: misura le primitive del display (tabella su ITM e sul
+       display) e si ferma. Da rilanciare prima e dopo ogni modifica al driver. */
+    LCD_Initialization();
+    bench_run(0);
+    while(1) { __ASM("wfi"); }
+#endif
+
     /* =========================================================================
        SEZIONE 1: POWER CONTROL FOR PERIPHERALS (PCONP)
        IMPORTANTE: Di default molte periferiche sono SPENTE per risparmiare energia.
@@ -60,6 +87,7 @@ int main(void)
     /* --- RIT --- */
     /* 50ms = 5.000.000 ticks @ 100MHz */
     // init_RIT(0x004C4B40); 
+    // RIT_set_tickless(1);    // Opzionale: interrupt solo quando serve (timer software, tasti)
     // enable_RIT();
 
     /* --- LCD & TOUCH --- */
@@ -68,6 +96,64 @@ int main(void)
     // LCD_Clear(White);
     // TP_Init(); 
     // TouchPanel_Calibrate(); 
+    /* Touch a interrupt (TIMER3 + GPIO P2.13): niente polling, arrivano EVENT_TOUCH */
+    // TP_IRQ_Init();
+
+    /* --- CONSOLE (log a scorrimento) --- */
+    /* Dopo LCD_Initialization. Andare a capo sull'ultima riga ridisegna solo la riga nuova */
+    // console_init(Green, Black);
+    // console_printf("punteggio: %d\n", score);
+    // console_exit();     // prima di tornare a disegnare con le altre primitive GLCD
+
+    /* --- FRAMEBUFFER OMBRA (animazioni senza sfarfallio) --- */
+    /* Si disegna con fb_xxx (indici di palette), fb_flush copia solo i tile cambiati */
+    // static const uint16_t pal[FB_COLORS] = { Black, White, Red, Yellow };
+    // fb_init(pal);
+    // fb_fill_rect(x, y, 16, 16, 2);  fb_flush();
+
+    /* --- SCENA (oggetti persistenti, si ridisegna solo cio' che cambia) --- */
+    /* Gli oggetti vanno dichiarati static o globali */
+    // static SCENE_Obj_t titolo, palla;
+    // scene_init(White);
+    // scene_text(&titolo, 60, 20, "MENU", Black, White, SCENE_TRANSPARENT, 1);  scene_add(&titolo);
+    // scene_rect(&palla, 100, 100, 8, 8, Red, 2);                               scene_add(&palla);
+    // scene_move(&palla, 104, 100);  scene_render();
+
+    /* --- SPRITE (salva e rimette lo sfondo letto dalla GRAM) --- */
+    /* img: 16*16 pixel RGB565, Magenta = trasparente; sfondo: 2*16*16 pixel */
+    // static uint16_t sfondo[2 * 16 * 16];  static SPRITE_t player;
+    // sprite_init(&player, img, 16, 16, Magenta, sfondo);
+    // sprite_show(&player, x, y);   ...   sprite_move(&player, x + 4, y);
+
+    /* --- IMMAGINI COMPRESSE (Host/img2c.cpp: PPM -> array C in formato Q5) --- */
+    // extern const uint8_t logo[];
+    // image_draw((MAX_X - image_width(logo)) / 2, 40, logo);
+
+    /* --- CLIP (pannelli: si disegna solo dentro il rettangolo) --- */
+    // LCD_PushClip(20, 60, 200, 100);      // annidabili fino a LCD_CLIP_DEPTH
+    // LCD_Clear(White);                    // riempie solo il pannello
+    // GUI_Text(10, 80, (uint8_t *)"testo lungo tagliato al bordo", Black, White);
+    // LCD_PopClip();
+
+    /* --- CARATTERI CINESI (solo quelli di hzfont/hz_chars.txt, vedi Host/hz2c.cpp) --- */
+    // hz_draw(20, 40, &hz_font, hz_find(&hz_font, 0x4E2D), White, Blue);    // per codice Unicode
+    // hz_draw(36, 40, &hz_font, hz_find_gb(&hz_font, (const uint8_t *)s), White, Blue);  // s: stringa GBK
+
+    /* --- TESTO UTF-8 / GBK (ASCII 8x16 e cinese 16x16 insieme, a capo da solo) --- */
+    // text_draw(10, 10, "Punti: 1234", TEXT_UTF8, White, Blue);              // '\n' va a capo
+    // n = text_box(10, 40, 200, messaggio, TEXT_UTF8, White, Blue);          // a capo fra le parole
+    // x = (MAX_X - text_width(titolo, TEXT_UTF8)) / 2;                       // centrare senza disegnare
+
+    /* --- FONT PROPORZIONALI (Host/font2c.cpp: TrueType -> array C) --- */
+    // font_draw(60, 20, &font_num48, "12:34", White, Black);      // cifre grandi: punteggi, orologi
+    // font_draw(10, 80, &font_sans16, "Punteggio", White, Black);
+    // font_draw_over(10, 100, &font_sans12, "sopra lo sfondo", Yellow);
+    // font_draw(10, 120, &font_sans16_aa, "Antialiasing", White, Blue);   // serve il colore di sfondo
+
+    /* --- HUD RIDISEGNATO A OGNI FRAME (cache dei glifi 8x16 gia' espansi, gcache.h) --- */
+    // gcache_text(8, 8, punti, White, Blue);                   // come GUI_Text su una riga, senza a capo
+    // gcache_putc(100, 8, '0' + vite, White, Blue);
+    // st = gcache_stats();                                     // hits/misses per scegliere GCACHE_SLOTS
     
     /* --- TIMER --- */
     /* FORMULA TIMER MATCH REGISTER:
@@ -259,13 +345,15 @@ int main(void)
     enum { STATE_MENU, STATE_PLAY, STATE_GAMEOVER };
     int current_state = STATE_MENU;
 
-    // Nel while(1):
+    // Nel while(1), per ogni evento estratto con event_get(&ev):
     switch(current_state) {
         case STATE_MENU:
-            if(down_0) { // Se premo bottone 0
+            if(ev.source == EVENT_INPUT && ev.code == INPUT_INT0 && ev.data == INPUT_PRESS) { // Se premo bottone 0
+                 // Con la scena niente LCD_Clear: si nascondono gli oggetti del menu e si
+                 // mostrano quelli del gioco, scene_render ridisegna solo le loro zone
+                 // scene_show(&titolo, 0);  scene_show(&palla, 1);  scene_render();
                  LCD_Clear(White);
                  current_state = STATE_PLAY;
-                 down_0 = 0; // Reset flag
             }
             break;
         case STATE_PLAY:
@@ -279,8 +367,36 @@ int main(void)
         /* Wait For Interrupt: Mette la CPU in pausa finch non arriva 
            un interrupt (Timer, RIT, Button). Risparmia batteria e riduce calore. 
            Toglilo se devi fare polling continuo nel while(1).
+           Si dorme solo a coda vuota, controllata a interrupt spenti: un evento
+           accodato fra l'ultimo event_get e il wfi resterebbe in coda fino al
+           prossimo interrupt (col RIT tickless anche centinaia di ms). Con
+           PRIMASK a 1 il wfi si sveglia comunque, l'interrupt parte dopo
+           __enable_irq.
         */
-        __ASM("wfi");
+        __disable_irq();
+        if(!event_pending()) {
+            __WFI();
+        }
+        __enable_irq();
+
+        /* Svuota la coda: gli eventi arrivati mentre il main era occupato
+           (es. a ridisegnare il display) non si perdono ne' si accorpano. */
+        while(event_get(&ev)) {
+            switch(ev.source) {
+                case EVENT_INPUT:   /* ev.code = INPUT_xxx, ev.data = INPUT_PRESS/RELEASE/LONG/REPEAT */
+                    break;
+                case EVENT_TOUCH:   /* ev.code = penna giu', EVENT_X(ev.data)/EVENT_Y(ev.data) grezzi */
+                    // Coordinate s = { EVENT_X(ev.data), EVENT_Y(ev.data) };
+                    // getDisplayPoint(&display, &s, &matrix);
+                    break;
+                case EVENT_TIMER:   /* ev.code = numero del timer */
+                    break;
+                case EVENT_ADC:     /* ev.data = valore 0x000..0xFFF */
+                    break;
+                default:
+                    break;
+            }
+        }
     }
 }
 
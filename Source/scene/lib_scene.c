@@ -0,0 +1,410 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_scene.c
+** Descriptions:        Lista di visualizzazione a rettangoli sporchi. I danni sono rettangoli in
+** coordinate schermo (estremi compresi); quelli che si toccano vengono uniti. Ogni zona si
+** ricompone per righe in scene_row: sfondo, poi il tratto di ogni oggetto che tocca la riga,
+** dal piu' lontano al piu' vicino, e la riga finita va nella finestra GRAM.
+** Correlated files:    scene.h, GLCD.c (LCD_BeginPixels/LCD_PushPixels)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include <string.h>
+#include "scene.h"
+#include "../GLCD/AsciiLib.h"
+
+typedef struct {
+    int16_t x0, y0, x1, y1;
+} SCENE_Rect;
+
+static SCENE_Obj_t *scene_list;                     /* z crescente */
+static uint16_t     scene_bg;
+static SCENE_Rect   scene_dmg[SCENE_DAMAGE_MAX];
+static uint8_t      scene_ndmg;
+static uint16_t     scene_row[MAX_X];
+
+/******************************************************************************
+** Function name:       scene_union
+** Descriptions:        Rettangolo che contiene a e b.
+******************************************************************************/
+static void scene_union( SCENE_Rect *a, const SCENE_Rect *b )
+{
+    if( b->x0 < a->x0 ) a->x0 = b->x0;
+    if( b->y0 < a->y0 ) a->y0 = b->y0;
+    if( b->x1 > a->x1 ) a->x1 = b->x1;
+    if( b->y1 > a->y1 ) a->y1 = b->y1;
+}
+
+/******************************************************************************
+** Function name:       scene_area
+** Descriptions:        Pixel di un rettangolo.
+******************************************************************************/
+static uint32_t scene_area( const SCENE_Rect *r )
+{
+    return (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+}
+
+/******************************************************************************
+** Function name:       scene_damage
+** Descriptions:        Aggiunge una zona tagliata allo schermo. Le zone che si
+**                      sovrappongono o si toccano diventano una sola (e il
+**                      risultato puo' toccarne altre: si riparte). Con la lista
+**                      piena si unisce alla zona che cresce di meno.
+******************************************************************************/
+void scene_damage( int16_t x, int16_t y, uint16_t w, uint16_t h )
+{
+    SCENE_Rect r, u;
+    int32_t x1 = (int32_t)x + w - 1, y1 = (int32_t)y + h - 1;
+    uint32_t grow, best_grow;
+    uint8_t i, best;
+
+    if( w == 0 || h == 0 || x1 < 0 || y1 < 0 || x >= MAX_X || y >= MAX_Y ){
+        return;
+    }
+    r.x0 = (x < 0) ? 0 : x;
+    r.y0 = (y < 0) ? 0 : y;
+    r.x1 = (x1 >= MAX_X) ? MAX_X - 1 : x1;
+    r.y1 = (y1 >= MAX_Y) ? MAX_Y - 1 : y1;
+
+    for( i = 0; i < scene_ndmg; ){
+        if( r.x0 <= scene_dmg[i].x1 + 1 && scene_dmg[i].x0 <= r.x1 + 1 &&
+            r.y0 <= scene_dmg[i].y1 + 1 && scene_dmg[i].y0 <= r.y1 + 1 ){
+            scene_union(&r, &scene_dmg[i]);
+            scene_dmg[i] = scene_dmg[--scene_ndmg];
+            i = 0;
+        }
+        else{
+            i++;
+        }
+    }
+
+    while( scene_ndmg == SCENE_DAMAGE_MAX ){
+        best = 0;
+        best_grow = 0xFFFFFFFF;
+        for( i = 0; i < scene_ndmg; i++ ){
+            u = scene_dmg[i];
+            scene_union(&u, &r);
+            grow = scene_area(&u) - scene_area(&scene_dmg[i]);
+            if( grow < best_grow ){
+                best_grow = grow;
+                best = i;
+            }
+        }
+        scene_union(&r, &scene_dmg[best]);
+        scene_dmg[best] = scene_dmg[--scene_ndmg];
+        /* la zona piu' grande puo' toccarne altre */
+        for( i = 0; i < scene_ndmg; ){
+            if( r.x0 <= scene_dmg[i].x1 + 1 && scene_dmg[i].x0 <= r.x1 + 1 &&
+                r.y0 <= scene_dmg[i].y1 + 1 && scene_dmg[i].y0 <= r.y1 + 1 ){
+                scene_union(&r, &scene_dmg[i]);
+                scene_dmg[i] = scene_dmg[--scene_ndmg];
+                i = 0;
+            }
+            else{
+                i++;
+            }
+        }
+    }
+    scene_dmg[scene_ndmg++] = r;
+}
+
+/******************************************************************************
+** Function name:       scene_damage_obj
+** Descriptions:        Danneggia la zona di un oggetto visibile nella scena.
+******************************************************************************/
+static void scene_damage_obj( const SCENE_Obj_t *o )
+{
+    if( o->linked && !(o->flags & SCENE_HIDDEN) ){
+        scene_damage(o->x, o->y, o->w, o->h);
+    }
+}
+
+/******************************************************************************
+** Function name:       scene_init
+** Descriptions:        Scena vuota, tutto da ridisegnare.
+******************************************************************************/
+void scene_init( uint16_t background )
+{
+    scene_list = 0;
+    scene_ndmg = 0;
+    scene_background(background);
+}
+
+/******************************************************************************
+** Function name:       scene_background
+** Descriptions:        Colore dello sfondo, tutto da ridisegnare.
+******************************************************************************/
+void scene_background( uint16_t background )
+{
+    scene_bg = background;
+    scene_damage(0, 0, MAX_X, MAX_Y);
+}
+
+/******************************************************************************
+** Function name:       scene_obj
+** Descriptions:        Campi comuni di un oggetto nuovo.
+******************************************************************************/
+static void scene_obj( SCENE_Obj_t *o, uint8_t type, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                       uint16_t fg, uint16_t bg, const void *data, uint8_t flags, uint8_t z )
+{
+    o->next   = 0;
+    o->x      = x;
+    o->y      = y;
+    o->w      = w;
+    o->h      = h;
+    o->fg     = fg;
+    o->bg     = bg;
+    o->data   = data;
+    o->type   = type;
+    o->z      = z;
+    o->flags  = flags;
+    o->linked = 0;
+}
+
+/******************************************************************************
+** Function name:       scene_rect
+** Descriptions:        Rettangolo pieno.
+******************************************************************************/
+void scene_rect( SCENE_Obj_t *o, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, uint8_t z )
+{
+    scene_obj(o, SCENE_RECT, x, y, w, h, color, color, 0, 0, z);
+}
+
+/******************************************************************************
+** Function name:       scene_text
+** Descriptions:        Testo su una riga: larghezza 8 * strlen(str).
+******************************************************************************/
+void scene_text( SCENE_Obj_t *o, int16_t x, int16_t y, const char *str, uint16_t fg, uint16_t bg, uint8_t flags, uint8_t z )
+{
+    scene_obj(o, SCENE_TEXT, x, y, 8 * strlen(str), 16, fg, bg, str, flags, z);
+}
+
+/******************************************************************************
+** Function name:       scene_bitmap
+** Descriptions:        Bitmap a 1 bit.
+******************************************************************************/
+void scene_bitmap( SCENE_Obj_t *o, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *bits,
+                   uint16_t fg, uint16_t bg, uint8_t flags, uint8_t z )
+{
+    scene_obj(o, SCENE_BITMAP, x, y, w, h, fg, bg, bits, flags, z);
+}
+
+/******************************************************************************
+** Function name:       scene_image
+** Descriptions:        Immagine RGB565; con SCENE_TRANSPARENT i pixel uguali a
+**                      'key' non sono disegnati (sprite).
+******************************************************************************/
+void scene_image( SCENE_Obj_t *o, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *pixels,
+                  uint16_t key, uint8_t flags, uint8_t z )
+{
+    scene_obj(o, SCENE_IMAGE, x, y, w, h, key, key, pixels, flags, z);
+}
+
+/******************************************************************************
+** Function name:       scene_add
+** Descriptions:        Inserisce dopo tutti gli oggetti con z minore o uguale.
+******************************************************************************/
+void scene_add( SCENE_Obj_t *o )
+{
+    SCENE_Obj_t **pp = &scene_list;
+
+    if( o->linked ){
+        return;
+    }
+    while( *pp != 0 && (*pp)->z <= o->z ){
+        pp = &(*pp)->next;
+    }
+    o->next = *pp;
+    *pp = o;
+    o->linked = 1;
+    scene_damage_obj(o);
+}
+
+/******************************************************************************
+** Function name:       scene_remove
+** Descriptions:        Toglie un oggetto e ridisegna quello che copriva.
+******************************************************************************/
+void scene_remove( SCENE_Obj_t *o )
+{
+    SCENE_Obj_t **pp = &scene_list;
+
+    while( *pp != 0 && *pp != o ){
+        pp = &(*pp)->next;
+    }
+    if( *pp == 0 ){
+        return;
+    }
+    scene_damage_obj(o);
+    *pp = o->next;
+    o->next = 0;
+    o->linked = 0;
+}
+
+/******************************************************************************
+** Function name:       scene_move
+** Descriptions:        Nuova posizione: zona vecchia e nuova da ridisegnare
+**                      (se si sovrappongono diventano una sola).
+******************************************************************************/
+void scene_move( SCENE_Obj_t *o, int16_t x, int16_t y )
+{
+    if( o->x == x && o->y == y ){
+        return;
+    }
+    scene_damage_obj(o);
+    o->x = x;
+    o->y = y;
+    scene_damage_obj(o);
+}
+
+/******************************************************************************
+** Function name:       scene_set_color
+** Descriptions:        Nuovi colori (per le immagini bg e' il colore chiave).
+******************************************************************************/
+void scene_set_color( SCENE_Obj_t *o, uint16_t fg, uint16_t bg )
+{
+    if( o->fg == fg && o->bg == bg ){
+        return;
+    }
+    o->fg = fg;
+    o->bg = bg;
+    scene_damage_obj(o);
+}
+
+/******************************************************************************
+** Function name:       scene_set_text
+** Descriptions:        Nuovo testo, anche di lunghezza diversa.
+******************************************************************************/
+void scene_set_text( SCENE_Obj_t *o, const char *str )
+{
+    scene_damage_obj(o);
+    o->data = str;
+    o->w    = 8 * strlen(str);
+    scene_damage_obj(o);
+}
+
+/******************************************************************************
+** Function name:       scene_show
+** Descriptions:        Mostra o nasconde un oggetto senza toglierlo dalla scena.
+******************************************************************************/
+void scene_show( SCENE_Obj_t *o, uint8_t visible )
+{
+    visible = (visible != 0);
+    if( visible == !(o->flags & SCENE_HIDDEN) ){
+        return;
+    }
+    if( visible ){
+        o->flags &= ~SCENE_HIDDEN;
+        scene_damage_obj(o);
+    }
+    else{
+        scene_damage_obj(o);
+        o->flags |= SCENE_HIDDEN;
+    }
+}
+
+/******************************************************************************
+** Function name:       scene_paint
+** Descriptions:        Il tratto dell'oggetto sulla riga y, colonne a..b, in
+**                      scene_row a partire dalla colonna x0 della zona.
+******************************************************************************/
+static void scene_paint( const SCENE_Obj_t *o, int16_t y, int16_t a, int16_t b, int16_t x0 )
+{
+    uint16_t *dst = &scene_row[a - x0];
+    uint16_t r = y - o->y, c = a - o->x;
+    uint8_t opaque = !(o->flags & SCENE_TRANSPARENT), row = 0;
+    const uint8_t *bits;
+    const uint16_t *src;
+    int16_t x;
+
+    switch( o->type ){
+    case SCENE_RECT:
+        for( x = a; x <= b; x++ ){
+            *dst++ = o->fg;
+        }
+        break;
+
+    case SCENE_TEXT:
+        for( x = a; x <= b; x++, c++, dst++ ){
+            if( x == a || (c % 8) == 0 ){       /* una riga del glifo ogni 8 pixel */
+                row = GetASCIIGlyph(((const char *)o->data)[c / 8])[r];
+            }
+            if( row & (0x80 >> (c % 8)) ){
+                *dst = o->fg;
+            }
+            else if( opaque ){
+                *dst = o->bg;
+            }
+        }
+        break;
+
+    case SCENE_BITMAP:
+        bits = (const uint8_t *)o->data + r * ((o->w + 7) / 8);
+        for( x = a; x <= b; x++, c++, dst++ ){
+            if( x == a || (c % 8) == 0 ){
+                row = bits[c / 8];
+            }
+            if( row & (0x80 >> (c % 8)) ){
+                *dst = o->fg;
+            }
+            else if( opaque ){
+                *dst = o->bg;
+            }
+        }
+        break;
+
+    case SCENE_IMAGE:
+        src = (const uint16_t *)o->data + (uint32_t)r * o->w + c;
+        if( opaque ){
+            memcpy(dst, src, (b - a + 1) * sizeof(uint16_t));
+            break;
+        }
+        for( x = a; x <= b; x++, src++, dst++ ){
+            if( *src != o->bg ){
+                *dst = *src;
+            }
+        }
+        break;
+    }
+}
+
+/******************************************************************************
+** Function name:       scene_render
+** Descriptions:        Per ogni zona danneggiata: una finestra GRAM, e per ogni
+**                      riga sfondo + oggetti che la toccano, tagliati alla zona.
+******************************************************************************/
+uint32_t scene_render( void )
+{
+    const SCENE_Rect *d;
+    const SCENE_Obj_t *o;
+    uint32_t pixels = 0;
+    uint16_t w, i;
+    int16_t y, a, b;
+    uint8_t k;
+
+    for( k = 0; k < scene_ndmg; k++ ){
+        d = &scene_dmg[k];
+        w = d->x1 - d->x0 + 1;
+
+        LCD_BeginPixels(d->x0, d->y0, w, d->y1 - d->y0 + 1);
+        for( y = d->y0; y <= d->y1; y++ ){
+            for( i = 0; i < w; i++ ){
+                scene_row[i] = scene_bg;
+            }
+            for( o = scene_list; o != 0; o = o->next ){
+                if( (o->flags & SCENE_HIDDEN) || y < o->y || y >= o->y + o->h ){
+                    continue;
+                }
+                a = (o->x > d->x0) ? o->x : d->x0;
+                b = (o->x + o->w - 1 < d->x1) ? o->x + o->w - 1 : d->x1;
+                if( a <= b ){
+                    scene_paint(o, y, a, b, d->x0);
+                }
+            }
+            LCD_PushPixels(scene_row, w);
+        }
+        LCD_EndPixels();
+        pixels += scene_area(d);
+    }
+    scene_ndmg = 0;
+    return pixels;
+}
@@ -0,0 +1,80 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           scene.h
+** Descriptions:        Lista di oggetti grafici persistenti (rettangoli, testo, bitmap, immagini) con
+**                      ordine z. Spostare o cambiare un oggetto segna da ridisegnare solo le zone
+**                      toccate; scene_render ricompone quelle zone riga per riga e le scrive in una
+**                      finestra GRAM ciascuna: ogni pixel e' scritto una volta, senza sfarfallio.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __SCENE_H
+#define __SCENE_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+#include "../GLCD/GLCD.h"
+
+#if ( DISP_ORIENTATION != 0 ) && ( DISP_ORIENTATION != 180 )
+#error "scene: scene_render scrive le finestre GRAM per righe, serve DISP_ORIENTATION 0 o 180"
+#endif
+
+/* Zone da ridisegnare tenute separate; oltre si uniscono le piu' vicine */
+#define SCENE_DAMAGE_MAX    8
+
+/* TIPI DI OGGETTO */
+enum {
+    SCENE_RECT = 1,     /* rettangolo pieno di colore fg */
+    SCENE_TEXT,         /* stringa 8x16 (data), fg su bg */
+    SCENE_BITMAP,       /* bitmap a 1 bit (data, MSB a sinistra, (w+7)/8 byte per riga), fg su bg */
+    SCENE_IMAGE         /* pixel RGB565 (data, w*h per righe) */
+};
+
+/* flags */
+#define SCENE_TRANSPARENT   0x01    /* testo/bitmap: bg non disegnato; immagine: pixel == bg saltati */
+#define SCENE_HIDDEN        0x02
+
+/* Un oggetto. Va allocato dall'utente (statico o globale) e non va spostato ne'
+ * distrutto mentre e' nella scena. data deve restare valido finche' l'oggetto e' nella
+ * scena. I campi si cambiano solo con le funzioni scene_xxx, che registrano i danni. */
+typedef struct SCENE_Obj {
+    struct SCENE_Obj *next;         /* in ordine di z crescente */
+    int16_t     x, y;               /* angolo in alto a sinistra, anche fuori schermo */
+    uint16_t    w, h;
+    uint16_t    fg, bg;
+    const void *data;
+    uint8_t     type;
+    uint8_t     z;                  /* z piu' alto = davanti */
+    uint8_t     flags;
+    uint8_t     linked;             /* 1 se nella scena */
+} SCENE_Obj_t;
+
+/* Scena vuota con colore di sfondo, tutto lo schermo da ridisegnare */
+extern void scene_init( uint16_t background );
+extern void scene_background( uint16_t background );
+
+/* Preparano un oggetto (non lo aggiungono alla scena) */
+extern void scene_rect( SCENE_Obj_t *o, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, uint8_t z );
+extern void scene_text( SCENE_Obj_t *o, int16_t x, int16_t y, const char *str, uint16_t fg, uint16_t bg, uint8_t flags, uint8_t z );
+extern void scene_bitmap( SCENE_Obj_t *o, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *bits,
+                          uint16_t fg, uint16_t bg, uint8_t flags, uint8_t z );
+extern void scene_image( SCENE_Obj_t *o, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *pixels,
+                         uint16_t key, uint8_t flags, uint8_t z );
+
+/* Aggiunge (davanti agli oggetti con lo stesso z) o toglie un oggetto */
+extern void scene_add( SCENE_Obj_t *o );
+extern void scene_remove( SCENE_Obj_t *o );
+
+/* Modifiche: ognuna segna da ridisegnare la zona vecchia e quella nuova */
+extern void scene_move( SCENE_Obj_t *o, int16_t x, int16_t y );
+extern void scene_set_color( SCENE_Obj_t *o, uint16_t fg, uint16_t bg );
+extern void scene_set_text( SCENE_Obj_t *o, const char *str );
+extern void scene_show( SCENE_Obj_t *o, uint8_t visible );
+
+/* Zona da ridisegnare, es. dopo aver cambiato i pixel di un'immagine o disegnato
+ * sul display direttamente */
+extern void scene_damage( int16_t x, int16_t y, uint16_t w, uint16_t h );
+
+/* Ridisegna le zone danneggiate. Ritorna i pixel scritti. Dal main, non dagli interrupt */
+extern uint32_t scene_render( void );
+
+#endif /* end __SCENE_H */
@@ -0,0 +1,278 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_sprite.c
+** Descriptions:        Sprite con save-under. Lo sfondo salvato copre solo la parte dello sprite
+** sullo schermo, per righe. Spostando, la nuova meta' di save prende dalla vecchia i pixel
+** comuni e dalla GRAM solo quelli nuovi; poi l'unione delle due zone viene riscritta in al
+** massimo tre finestre (righe solo della zona vecchia, righe comuni, righe solo della nuova).
+** Correlated files:    sprite.h, GLCD.c (LCD_BeginRead/LCD_ReadPixels, LCD_BeginPixels)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include <string.h>
+#include "sprite.h"
+
+typedef struct {
+    int16_t x0, y0, x1, y1;
+} SPR_Rect;
+
+static uint16_t spr_row[MAX_X];
+
+#define SPR_MIN(a, b)   ( ((a) < (b)) ? (a) : (b) )
+#define SPR_MAX(a, b)   ( ((a) > (b)) ? (a) : (b) )
+#define SPR_IN(r, x, y) ( (x) >= (r)->x0 && (x) <= (r)->x1 && (y) >= (r)->y0 && (y) <= (r)->y1 )
+
+/******************************************************************************
+** Function name:       spr_clip
+** Descriptions:        Parte sullo schermo dello sprite in (x, y). Ritorna 0 se
+**                      e' tutto fuori.
+******************************************************************************/
+static uint8_t spr_clip( const SPRITE_t *s, int16_t x, int16_t y, SPR_Rect *r )
+{
+    r->x0 = SPR_MAX(x, 0);
+    r->y0 = SPR_MAX(y, 0);
+    r->x1 = SPR_MIN(x + (int16_t)s->w - 1, MAX_X - 1);
+    r->y1 = SPR_MIN(y + (int16_t)s->h - 1, MAX_Y - 1);
+    return r->x0 <= r->x1 && r->y0 <= r->y1;
+}
+
+/******************************************************************************
+** Function name:       spr_save
+** Descriptions:        Meta' 'half' del buffer dello sfondo.
+******************************************************************************/
+static uint16_t *spr_save( const SPRITE_t *s, uint8_t half )
+{
+    return s->save + (half ? (uint32_t)s->w * s->h : 0);
+}
+
+/******************************************************************************
+** Function name:       spr_read
+** Descriptions:        Legge dalla GRAM il rettangolo (x0,y0)-(x1,y1), interno a
+**                      n, nelle posizioni corrispondenti di nsave.
+******************************************************************************/
+static void spr_read( int16_t x0, int16_t y0, int16_t x1, int16_t y1, const SPR_Rect *n, uint16_t *nsave )
+{
+    uint16_t stride = n->x1 - n->x0 + 1;
+    int16_t y;
+
+    if( x1 < x0 || y1 < y0 ){
+        return;
+    }
+    LCD_BeginRead(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+    for( y = y0; y <= y1; y++ ){
+        LCD_ReadPixels(&nsave[(y - n->y0) * stride + (x0 - n->x0)], x1 - x0 + 1);
+    }
+    LCD_EndPixels();
+}
+
+/******************************************************************************
+** Function name:       spr_compose
+** Descriptions:        Scrive il rettangolo (x0,y0)-(x1,y1) in una finestra:
+**                      dentro n lo sprite (dove non e' trasparente, altrimenti lo
+**                      sfondo nsave), fuori da n lo sfondo vecchio osave di o.
+**                      n o o possono essere NULL.
+******************************************************************************/
+static void spr_compose( const SPRITE_t *s, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         const SPR_Rect *n, const uint16_t *nsave, const SPR_Rect *o, const uint16_t *osave )
+{
+    uint16_t nstride = n ? n->x1 - n->x0 + 1 : 0;
+    uint16_t ostride = o ? o->x1 - o->x0 + 1 : 0;
+    uint16_t *dst, p;
+    int16_t x, y;
+
+    if( x1 < x0 || y1 < y0 ){
+        return;
+    }
+    LCD_BeginPixels(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+    for( y = y0; y <= y1; y++ ){
+        dst = spr_row;
+        for( x = x0; x <= x1; x++ ){
+            if( n != 0 && SPR_IN(n, x, y) ){
+                p = s->image[(y - s->y) * s->w + (x - s->x)];
+                if( p == s->key ){
+                    p = nsave[(y - n->y0) * nstride + (x - n->x0)];
+                }
+            }
+            else{
+                p = osave[(y - o->y0) * ostride + (x - o->x0)];
+            }
+            *dst++ = p;
+        }
+        LCD_PushPixels(spr_row, x1 - x0 + 1);
+    }
+    LCD_EndPixels();
+}
+
+/******************************************************************************
+** Function name:       spr_restore
+** Descriptions:        Rimette lo sfondo nella zona coperta ora.
+******************************************************************************/
+static void spr_restore( SPRITE_t *s )
+{
+    SPR_Rect o = { s->x0, s->y0, s->x1, s->y1 };
+
+    spr_compose(s, o.x0, o.y0, o.x1, o.y1, 0, 0, &o, spr_save(s, s->half));
+}
+
+/******************************************************************************
+** Function name:       spr_draw
+** Descriptions:        Salva tutto lo sfondo di n e ci disegna lo sprite.
+******************************************************************************/
+static void spr_draw( SPRITE_t *s, const SPR_Rect *n )
+{
+    uint16_t *nsave = spr_save(s, s->half);
+
+    spr_read(n->x0, n->y0, n->x1, n->y1, n, nsave);
+    spr_compose(s, n->x0, n->y0, n->x1, n->y1, n, nsave, 0, 0);
+}
+
+/******************************************************************************
+** Function name:       spr_set
+** Descriptions:        Memorizza posizione e zona coperta (vuota: x1 < x0).
+******************************************************************************/
+static void spr_set( SPRITE_t *s, int16_t x, int16_t y, const SPR_Rect *r, uint8_t on_screen )
+{
+    s->x  = x;
+    s->y  = y;
+    s->x0 = r->x0;
+    s->y0 = r->y0;
+    s->x1 = on_screen ? r->x1 : r->x0 - 1;
+    s->y1 = r->y1;
+}
+
+/******************************************************************************
+** Function name:       sprite_init
+** Descriptions:        Sprite nascosto in (0, 0).
+******************************************************************************/
+void sprite_init( SPRITE_t *s, const uint16_t *image, uint16_t w, uint16_t h, uint16_t key, uint16_t *save )
+{
+    memset(s, 0, sizeof(*s));
+    s->image = image;
+    s->save  = save;
+    s->w     = w;
+    s->h     = h;
+    s->key   = key;
+}
+
+/******************************************************************************
+** Function name:       sprite_show
+** Descriptions:        Lettura e scrittura della zona coperta (w*h + w*h pixel).
+******************************************************************************/
+void sprite_show( SPRITE_t *s, int16_t x, int16_t y )
+{
+    SPR_Rect n;
+    uint8_t on;
+
+    if( s->visible ){
+        sprite_move(s, x, y);
+        return;
+    }
+    on = spr_clip(s, x, y, &n);
+    s->x = x;                       /* spr_compose legge l'immagine da s->x, s->y */
+    s->y = y;
+    if( on ){
+        spr_draw(s, &n);
+    }
+    spr_set(s, x, y, &n, on);
+    s->visible = 1;
+}
+
+/******************************************************************************
+** Function name:       sprite_hide
+** Descriptions:        Solo scritture (w*h pixel).
+******************************************************************************/
+void sprite_hide( SPRITE_t *s )
+{
+    if( !s->visible ){
+        return;
+    }
+    if( s->x0 <= s->x1 ){
+        spr_restore(s);
+    }
+    s->visible = 0;
+}
+
+/******************************************************************************
+** Function name:       sprite_move
+** Descriptions:        Zone sovrapposte: i pixel comuni passano da una meta' di
+**                      save all'altra, dalla GRAM si leggono solo i nuovi, e
+**                      l'unione si riscrive per fasce di righe. Zone separate:
+**                      si rimette lo sfondo e si ridisegna da capo.
+******************************************************************************/
+void sprite_move( SPRITE_t *s, int16_t x, int16_t y )
+{
+    SPR_Rect n, o = { s->x0, s->y0, s->x1, s->y1 };
+    const SPR_Rect *first, *last;
+    uint16_t *nsave, *osave, nstride, ostride;
+    int16_t yi0, yi1, r;
+    uint8_t on;
+
+    if( x == s->x && y == s->y ){
+        return;
+    }
+    if( !s->visible ){
+        s->x = x;
+        s->y = y;
+        return;
+    }
+
+    on = spr_clip(s, x, y, &n);
+    if( !on || o.x1 < o.x0 || n.x0 > o.x1 || o.x0 > n.x1 || n.y0 > o.y1 || o.y0 > n.y1 ){
+        if( o.x0 <= o.x1 ){
+            spr_restore(s);
+        }
+        s->x = x;
+        s->y = y;
+        if( on ){
+            spr_draw(s, &n);
+        }
+        spr_set(s, x, y, &n, on);
+        return;
+    }
+
+    osave   = spr_save(s, s->half);
+    nsave   = spr_save(s, s->half ^ 1);
+    nstride = n.x1 - n.x0 + 1;
+    ostride = o.x1 - o.x0 + 1;
+    yi0     = SPR_MAX(n.y0, o.y0);          /* righe comuni */
+    yi1     = SPR_MIN(n.y1, o.y1);
+
+    /* sfondo nuovo: la parte comune dal salvataggio vecchio... */
+    for( r = yi0; r <= yi1; r++ ){
+        memcpy(&nsave[(r - n.y0) * nstride + (SPR_MAX(n.x0, o.x0) - n.x0)],
+               &osave[(r - o.y0) * ostride + (SPR_MAX(n.x0, o.x0) - o.x0)],
+               (SPR_MIN(n.x1, o.x1) - SPR_MAX(n.x0, o.x0) + 1) * sizeof(uint16_t));
+    }
+    /* ...il resto dalla GRAM: fasce sopra e sotto, pezzi a sinistra e a destra */
+    spr_read(n.x0, n.y0, n.x1, yi0 - 1, &n, nsave);
+    spr_read(n.x0, yi1 + 1, n.x1, n.y1, &n, nsave);
+    spr_read(n.x0, yi0, o.x0 - 1, yi1, &n, nsave);
+    spr_read(o.x1 + 1, yi0, n.x1, yi1, &n, nsave);
+
+    /* unione per fasce: solo la zona che inizia prima, entrambe, solo quella che finisce dopo */
+    s->x = x;
+    s->y = y;
+    first = (n.y0 < o.y0) ? &n : &o;
+    last  = (n.y1 > o.y1) ? &n : &o;
+    spr_compose(s, first->x0, first->y0, first->x1, yi0 - 1, &n, nsave, &o, osave);
+    spr_compose(s, SPR_MIN(n.x0, o.x0), yi0, SPR_MAX(n.x1, o.x1), yi1, &n, nsave, &o, osave);
+    spr_compose(s, last->x0, yi1 + 1, last->x1, last->y1, &n, nsave, &o, osave);
+
+    s->half ^= 1;
+    spr_set(s, x, y, &n, 1);
+}
+
+/******************************************************************************
+** Function name:       sprite_frame
+** Descriptions:        Nuova immagine della stessa dimensione, ridisegnata sullo
+**                      sfondo gia' salvato.
+******************************************************************************/
+void sprite_frame( SPRITE_t *s, const uint16_t *image )
+{
+    SPR_Rect n = { s->x0, s->y0, s->x1, s->y1 };
+
+    s->image = image;
+    if( s->visible && n.x0 <= n.x1 ){
+        spr_compose(s, n.x0, n.y0, n.x1, n.y1, &n, spr_save(s, s->half), 0, 0);
+    }
+}
@@ -0,0 +1,51 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           sprite.h
+** Descriptions:        Sprite con salvataggio dello sfondo letto dalla GRAM: mostrare uno sprite
+**                      salva i pixel che copre, spostarlo rimette lo sfondo dove non c'e' piu' e
+**                      disegna lo sprite nella nuova posizione, senza ridisegnare la scena.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __SPRITE_H
+#define __SPRITE_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+#include "../GLCD/GLCD.h"
+
+#if ( DISP_ORIENTATION != 0 ) && ( DISP_ORIENTATION != 180 )
+#error "sprite: le finestre GRAM sono lette e scritte per righe, serve DISP_ORIENTATION 0 o 180"
+#endif
+
+/* Uno sprite. Va allocato dall'utente (statico o globale); i campi sono privati.
+ * Sprite sovrapposti vanno nascosti in ordine inverso a quello in cui sono stati
+ * mostrati, e sotto uno sprite visibile non si disegna (lo sfondo salvato non cambierebbe). */
+typedef struct {
+    const uint16_t *image;          /* w*h pixel RGB565 per righe */
+    uint16_t       *save;           /* 2*w*h pixel: sfondo salvato, due meta' alternate */
+    uint16_t        w, h;
+    uint16_t        key;            /* colore trasparente dell'immagine */
+    int16_t         x, y;           /* posizione, anche fuori schermo */
+    int16_t         x0, y0, x1, y1; /* parte sullo schermo coperta ora (estremi compresi) */
+    uint8_t         visible;
+    uint8_t         half;           /* meta' di save in uso */
+} SPRITE_t;
+
+/* Prepara uno sprite nascosto. save deve contenere 2 * w * h pixel */
+extern void sprite_init( SPRITE_t *s, const uint16_t *image, uint16_t w, uint16_t h, uint16_t key, uint16_t *save );
+
+/* Salva lo sfondo in (x, y) e disegna lo sprite */
+extern void sprite_show( SPRITE_t *s, int16_t x, int16_t y );
+
+/* Rimette lo sfondo salvato */
+extern void sprite_hide( SPRITE_t *s );
+
+/* Sposta uno sprite visibile (nascosto: cambia solo la posizione). Se la zona vecchia
+ * e la nuova si sovrappongono si legge dalla GRAM solo la parte nuova e si riscrive
+ * l'unione una volta: uno sprite 16x16 spostato di 4 pixel costa 64 letture e 320 scritture */
+extern void sprite_move( SPRITE_t *s, int16_t x, int16_t y );
+
+/* Cambia immagine (fotogramma di un'animazione) senza spostarlo: solo scritture */
+extern void sprite_frame( SPRITE_t *s, const uint16_t *image );
+
+#endif /* end __SPRITE_H */
@@ -0,0 +1,234 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           lib_text.c
+** Descriptions:        Decodifica UTF-8 / GBK, misura, a capo e scrittura a righe. Per ogni riga si
+** raccolgono le righe di bit dei glifi visibili (hz_rows per i cinesi), poi ogni riga di pixel
+** della finestra viene espansa in text_px e scritta con un solo LCD_PushPixels.
+** Correlated files:    text.h, hzfont.h, AsciiLib.c (GetASCIIGlyph), GLCD.c (LCD_GetClip)
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#include "LPC17xx.h"
+#include "text.h"
+#include "../GLCD/AsciiLib.h"
+
+typedef struct {
+    int16_t  hz;                    /* glifo di hz_font, -1 per un carattere ASCII */
+    uint8_t  c;                     /* carattere ASCII */
+    uint8_t  w;                     /* larghezza, 8 o HZ_SIZE */
+} TEXT_Glyph;
+
+static uint16_t text_rows[TEXT_RUN][HZ_SIZE];   /* glifi della finestra, bit 15 = colonna sinistra */
+static uint8_t  text_w[TEXT_RUN];
+static uint16_t text_px[MAX_X + 2 * HZ_SIZE];   /* una riga dei glifi della finestra, bordi compresi */
+
+/******************************************************************************
+** Function name:       text_decode
+** Descriptions:        Legge un carattere da s e ritorna il byte dopo. Una
+**                      sequenza troncata (anche dal '\0') finisce prima del
+**                      byte che non ne fa parte, che si rilegge come carattere.
+******************************************************************************/
+static const uint8_t *text_decode( const uint8_t *s, uint8_t enc, TEXT_Glyph *g )
+{
+    uint32_t cp;
+    uint8_t  n, k;
+
+    g->hz = -1;
+    g->c  = *s;
+    g->w  = 8;
+    if( *s < 0x80 ){
+        return s + 1;
+    }
+    g->c = '?';
+
+    if( enc == TEXT_GBK ){
+        if( s[1] < 0x40 ){
+            return s + 1;
+        }
+        g->hz = hz_find_gb(&hz_font, s);
+        g->w  = (g->hz < 0) ? 8 : HZ_SIZE;
+        return s + 2;
+    }
+
+    n = (*s >= 0xF0) ? 3 : (*s >= 0xE0) ? 2 : (*s >= 0xC0) ? 1 : 0;
+    cp = *s & (0x3F >> n);
+    for( k = 1; k <= n; k++ ){
+        if( (s[k] & 0xC0) != 0x80 ){
+            return s + k;
+        }
+        cp = (cp << 6) | (s[k] & 0x3F);
+    }
+    if( n > 0 && cp <= 0xFFFF ){
+        g->hz = hz_find(&hz_font, (uint16_t)cp);
+        g->w  = (g->hz < 0) ? 8 : HZ_SIZE;
+    }
+    return s + n + 1;
+}
+
+/******************************************************************************
+** Function name:       text_width
+** Descriptions:        Somma delle larghezze fino a '\0' o '\n'.
+******************************************************************************/
+uint16_t text_width( const char *str, uint8_t enc )
+{
+    const uint8_t *s = (const uint8_t *)str;
+    TEXT_Glyph g;
+    uint16_t   w = 0;
+
+    while( *s != 0 && *s != '\n' ){
+        s = text_decode(s, enc, &g);
+        w += g.w;
+    }
+    return w;
+}
+
+/******************************************************************************
+** Function name:       text_line
+** Descriptions:        Avanza finche' la riga sta in width, ricordando l'ultimo
+**                      punto dove si puo' andare a capo (cut) e dove riprende
+**                      la riga dopo (resume): su uno spazio, che si salta, o
+**                      prima e dopo un carattere cinese (non dopo uno spazio,
+**                      che altrimenti resterebbe in fondo alla riga).
+******************************************************************************/
+uint16_t text_line( const char *str, uint8_t enc, uint16_t width, const char **next )
+{
+    const uint8_t *start = (const uint8_t *)str, *s = start, *p;
+    const uint8_t *cut = NULL, *resume = NULL;
+    TEXT_Glyph g;
+    uint16_t   x = 0;
+    uint8_t    wide = 0;            /* il carattere prima era cinese */
+
+    while( *s != 0 && *s != '\n' ){
+        p = text_decode(s, enc, &g);
+        if( s != start && (*s == ' ' || ((wide || g.hz >= 0) && s[-1] != ' ')) ){
+            cut    = s;
+            resume = (*s == ' ') ? s + 1 : s;
+        }
+        if( s != start && x + g.w > width ){
+            if( cut == NULL ){
+                cut = resume = s;   /* nessun punto buono: si spezza qui */
+            }
+            *next = (const char *)resume;
+            return (uint16_t)(cut - start);
+        }
+        wide = (g.hz >= 0);
+        x   += g.w;
+        s    = p;
+    }
+    *next = (const char *)((*s == '\n') ? s + 1 : s);
+    return (uint16_t)(s - start);
+}
+
+/******************************************************************************
+** Function name:       text_lines
+** Descriptions:        Conta le righe di text_line senza disegnare.
+******************************************************************************/
+uint16_t text_lines( const char *str, uint8_t enc, uint16_t width )
+{
+    uint16_t n = 0;
+
+    while( *str != 0 ){
+        text_line(str, enc, width, &str);
+        n++;
+    }
+    return n;
+}
+
+/******************************************************************************
+** Function name:       text_draw_n
+** Descriptions:        Decodifica la riga tenendo solo i glifi che toccano il
+**                      clip; poi una finestra sulla parte visibile e, per ogni
+**                      riga di pixel, i glifi espansi in text_px.
+******************************************************************************/
+uint16_t text_draw_n( uint16_t Xpos, uint16_t Ypos, const char *str, uint16_t len,
+                      uint8_t enc, uint16_t charColor, uint16_t bkColor )
+{
+    const LCD_Rect *clip = LCD_GetClip();
+    const uint8_t  *s = (const uint8_t *)str, *end = s + len, *a;
+    TEXT_Glyph g;
+    int32_t    x = Xpos, gx = 0, x0, x1;
+    int16_t    y0, y1, y;
+    uint16_t   bits, *px;
+    uint8_t    n = 0, k, i;
+
+    y0 = (clip->y0 > Ypos) ? clip->y0 - Ypos : 0;
+    y1 = (clip->y1 < Ypos + TEXT_HEIGHT - 1) ? clip->y1 - Ypos : TEXT_HEIGHT - 1;
+
+    while( s < end && *s != 0 ){
+        s = text_decode(s, enc, &g);
+        if( y0 <= y1 && x + g.w > clip->x0 && x <= clip->x1 ){
+            if( n == 0 ){
+                gx = x;
+            }
+            if( g.hz >= 0 ){
+                hz_rows(&hz_font, g.hz, text_rows[n]);
+            }else{
+                a = GetASCIIGlyph(g.c);
+                for( i = 0; i < TEXT_HEIGHT; i++ ){
+                    text_rows[n][i] = (uint16_t)a[i] << 8;
+                }
+            }
+            text_w[n++] = g.w;
+        }
+        x += g.w;
+    }
+    if( n == 0 ){
+        return (uint16_t)(x - Xpos);
+    }
+
+    /* colonne visibili della finestra, relative al primo glifo raccolto */
+    x0 = (clip->x0 > gx) ? clip->x0 - gx : 0;
+    for( x1 = -1, k = 0; k < n; k++ ){
+        x1 += text_w[k];
+    }
+    if( x1 > clip->x1 - gx ){
+        x1 = clip->x1 - gx;
+    }
+    if( x1 < x0 ){
+        return (uint16_t)(x - Xpos);    /* clip vuoto */
+    }
+
+    LCD_BeginPixels(gx + x0, Ypos + y0, x1 - x0 + 1, y1 - y0 + 1);
+    for( y = y0; y <= y1; y++ ){
+        px = text_px;
+        for( k = 0; k < n; k++ ){
+            bits = text_rows[k][y];
+            for( i = text_w[k]; i > 0; i-- ){
+                *px++ = (bits & 0x8000) ? charColor : bkColor;
+                bits <<= 1;
+            }
+        }
+        LCD_PushPixels(&text_px[x0], x1 - x0 + 1);
+    }
+    LCD_EndPixels();
+    return (uint16_t)(x - Xpos);
+}
+
+/******************************************************************************
+** Function name:       text_box
+** Descriptions:        Una riga di text_line alla volta.
+******************************************************************************/
+uint16_t text_box( uint16_t Xpos, uint16_t Ypos, uint16_t width, const char *str,
+                   uint8_t enc, uint16_t charColor, uint16_t bkColor )
+{
+    const char *line;
+    uint16_t    len, n = 0;
+
+    while( *str != 0 && Ypos <= LCD_GetClip()->y1 ){
+        line = str;
+        len  = text_line(line, enc, width, &str);
+        text_draw_n(Xpos, Ypos, line, len, enc, charColor, bkColor);
+        Ypos += TEXT_HEIGHT;
+        n++;
+    }
+    return n;
+}
+
+/******************************************************************************
+** Function name:       text_draw
+** Descriptions:        text_box senza limite di larghezza.
+******************************************************************************/
+uint16_t text_draw( uint16_t Xpos, uint16_t Ypos, const char *str,
+                    uint8_t enc, uint16_t charColor, uint16_t bkColor )
+{
+    return text_box(Xpos, Ypos, TEXT_NOWRAP, str, enc, charColor, bkColor);
+}
@@ -0,0 +1,57 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           text.h
+** Descriptions:        Testo misto ASCII / cinese da stringhe UTF-8 o GBK: caratteri ASCII 8x16 di
+**                      AsciiLib, caratteri cinesi 16x16 di hz_font (solo quelli di hz_chars.txt).
+**                      Ogni riga si scrive in una sola finestra GRAM, tagliata al clip del GLCD.
+**                      Misura e a capo non disegnano nulla: servono per impaginare prima.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+#ifndef __TEXT_H
+#define __TEXT_H
+
+#include "LPC17xx.h"
+#include <stdint.h>
+#include "../GLCD/GLCD.h"
+#include "../hzfont/hzfont.h"
+
+/* Codifica delle stringhe */
+#define TEXT_UTF8           0
+#define TEXT_GBK            1
+
+#define TEXT_HEIGHT         16                  /* altezza di una riga */
+#define TEXT_NOWRAP         0xFFFF              /* larghezza: a capo solo su '\n' */
+
+/* Glifi per finestra: quelli che toccano il clip sono al massimo MAX_X / 8 + 2
+ * (due tagliati ai bordi), quindi una riga visibile entra sempre in una finestra */
+#define TEXT_RUN            ( MAX_X / 8 + 2 )
+
+/* Un carattere che non e' ASCII e non e' in hz_font (o una sequenza non valida)
+ * vale '?', largo 8. '\n' chiude la riga; gli altri caratteri di controllo sono spazi */
+
+/* Larghezza in pixel della riga che inizia in str (fino a '\0' o '\n') */
+extern uint16_t text_width( const char *str, uint8_t enc );
+
+/* Quanti byte di str entrano in width pixel: si va a capo all'ultimo spazio, prima
+ * o dopo un carattere cinese, o a '\n'; una parola piu' lunga di width viene spezzata.
+ * *next: inizio della riga dopo (lo spazio o il '\n' dove si e' andati a capo sono saltati),
+ * alla fine punta al '\0' */
+extern uint16_t text_line( const char *str, uint8_t enc, uint16_t width, const char **next );
+
+/* Righe che occupa str in una colonna larga width (0 per la stringa vuota) */
+extern uint16_t text_lines( const char *str, uint8_t enc, uint16_t width );
+
+/* Scrive len byte di str su una riga (una finestra GRAM); ritorna la larghezza */
+extern uint16_t text_draw_n( uint16_t Xpos, uint16_t Ypos, const char *str, uint16_t len,
+                             uint8_t enc, uint16_t charColor, uint16_t bkColor );
+
+/* Scrive str andando a capo come text_line, una riga ogni TEXT_HEIGHT pixel.
+ * Ritorna le righe scritte: ci si ferma alla prima riga sotto il clip */
+extern uint16_t text_box( uint16_t Xpos, uint16_t Ypos, uint16_t width, const char *str,
+                          uint8_t enc, uint16_t charColor, uint16_t bkColor );
+
+/* Come text_box, a capo solo su '\n' */
+extern uint16_t text_draw( uint16_t Xpos, uint16_t Ypos, const char *str,
+                           uint8_t enc, uint16_t charColor, uint16_t bkColor );
+
+#endif /* end __TEXT_H */
@@ -6,6 +6,8 @@
 *********************************************************************************************************/
 #include "LPC17xx.h"
 #include "timer.h"
+#include "../TouchPanel/TouchPanel.h"
+#include "../event/event.h"
 
 /* INCLUSIONI OPZIONALI
  * Decommenta queste righe se devi interagire con altre periferiche dentro l'interrupt.
@@ -36,9 +38,15 @@ void TIMER0_IRQHandler (void)
         ** ESEMPIO A: TOGGLE DI UN LED (Heartbeat)
         ** Utile per verificare visivamente che il timer stia girando alla frequenza giusta.
         ** PREREQUISITI: Nel main() devi aver impostato la direzione: LPC_GPIO2->FIODIR |= (1<<0);
+        ** Non qui: P2.0-7 sono anche il bus dati del display (vedi GLCD.h), un LED
+        ** scritto durante un disegno sporca i pixel. Lo si inverte nel main,
+        ** all'evento EVENT_TIMER con code 0 accodato qui sotto:
         **************************************************************************/
         /*
-        LPC_GPIO2->FIOPIN ^= (1 << 0);  // Esegue XOR sul bit 0 del Port 2 (inverte lo stato)
+        // Nel while(1) del main, per ogni evento di event_get:
+        if(ev.source == EVENT_TIMER && ev.code == 0) {
+            LPC_GPIO2->FIOPIN ^= (1 << 0);  // Esegue XOR sul bit 0 del Port 2 (inverte lo stato)
+        }
         */
 
         /**************************************************************************
@@ -67,6 +75,7 @@ void TIMER0_IRQHandler (void)
 			
         /* --- FINE CODICE UTENTE MR0 --- */
 
+        event_post(EVENT_TIMER, 0, 0);  // Segnala il match al main (event_get)
         LPC_TIM0->IR = 1;           // Pulisce il flag di interrupt MR0
     }
     /* Controllo Match Register 1 */
@@ -104,6 +113,7 @@ void TIMER1_IRQHandler (void)
     if(LPC_TIM1->IR & 1) // MR0
     {
         // Inserisci qui il codice per Timer 1 MR0
+        event_post(EVENT_TIMER, 1, 0);
         LPC_TIM1->IR = 1; 
     }
     else if(LPC_TIM1->IR & 2) // MR1
@@ -141,6 +151,7 @@ void TIMER2_IRQHandler (void)
         */
 			
         // Inserisci qui il codice per Timer 2 MR0
+        event_post(EVENT_TIMER, 2, 0);
         LPC_TIM2->IR = 1; 
     }
     else if(LPC_TIM2->IR & 2) // MR1
@@ -165,6 +176,10 @@ void TIMER3_IRQHandler (void)
 {
     if(LPC_TIM3->IR & 1) // MR0
     { 
+        /* Se si usa TP_IRQ_Init() il Timer 3 MR0 cadenza il campionamento del touch.
+         * Senza TP_IRQ_Init() la chiamata non fa nulla. */
+        TP_TimerTick();
+
         // Inserisci qui il codice per Timer 3 MR0
         LPC_TIM3->IR = 1; 
     }